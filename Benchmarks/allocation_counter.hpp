@@ -0,0 +1,106 @@
+/**
+ *	Replacement of global allocation functions counting every heap
+ *	allocation made by the program. Used by benchmarks to measure how
+ *	many allocations happen per generation
+ *
+ *	Authors: Michal Swiatek, Michal Sulek
+ *	Update:	 17.10.2026
+ *
+ *	Github repository: https://github.com/MichalKonradSulek/ZPR
+ */
+
+#ifndef __ALLOCATION_COUNTER__
+#define __ALLOCATION_COUNTER__
+
+#include <new>
+#include <atomic>
+#include <cstdlib>
+
+namespace ga {
+namespace benchmark {
+
+	inline std::atomic<size_t>& allocationCounter()
+	{
+		static std::atomic<size_t> counter(0);
+		return counter;
+	}
+
+	/**
+	 *	@brief	Number of heap allocations made since program start
+	 */
+	inline size_t getAllocationCount()
+	{
+		return allocationCounter().load(std::memory_order_relaxed);
+	}
+
+}
+}
+
+//	Replaceable allocation functions can be defined only once per program,
+//	so this header has to be included in exactly one translation unit. All
+//	forms allocate and free trough the same pair of functions, which are kept
+//	out of line, so that compiler doesn't match free() with operator new
+namespace ga {
+namespace benchmark {
+namespace detail {
+
+#if defined(__GNUC__)
+	__attribute__((noinline))
+#elif defined(_MSC_VER)
+	__declspec(noinline)
+#endif
+	void* countedAllocate(size_t size)
+	{
+		allocationCounter().fetch_add(1, std::memory_order_relaxed);
+
+		if (void* ptr = std::malloc(size == 0 ? 1 : size))
+			return ptr;
+
+		throw std::bad_alloc();
+	}
+
+#if defined(__GNUC__)
+	__attribute__((noinline))
+#elif defined(_MSC_VER)
+	__declspec(noinline)
+#endif
+	void countedFree(void* ptr) noexcept
+	{
+		std::free(ptr);
+	}
+
+}
+}
+}
+
+void* operator new(size_t size)
+{
+	return ga::benchmark::detail::countedAllocate(size);
+}
+
+void* operator new[](size_t size)
+{
+	return ga::benchmark::detail::countedAllocate(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+	ga::benchmark::detail::countedFree(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+	ga::benchmark::detail::countedFree(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+	ga::benchmark::detail::countedFree(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept
+{
+	ga::benchmark::detail::countedFree(ptr);
+}
+
+#endif // !__ALLOCATION_COUNTER__
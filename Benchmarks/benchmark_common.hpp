@@ -0,0 +1,156 @@
+/**
+ *	Specimens and fitness functions shared by microbenchmarks. Genome
+ *	length is chosen at runtime, so one Specimen type serves benchmarks
+ *	parameterized by genome length
+ *
+ *	Authors: Michal Swiatek, Michal Sulek
+ *	Update:	 17.10.2026
+ *
+ *	Github repository: https://github.com/MichalKonradSulek/ZPR
+ */
+
+#ifndef __BENCHMARK_COMMON__
+#define __BENCHMARK_COMMON__
+
+#include "../ga.hpp"
+
+#include <atomic>
+
+namespace ga {
+namespace benchmark {
+
+	/**
+	 *	@brief	Random value of a gene drawn from getRandom()
+	 */
+	template <typename GeneType>
+	GeneType randomGene()
+	{
+		return GeneType(getRandom().uniform(1000));
+	}
+
+	template <>
+	inline bool randomGene<bool>()
+	{
+		return getRandom().uniform(2) == 1;
+	}
+
+	template <>
+	inline char randomGene<char>()
+	{
+		return char('a' + getRandom().uniform(26));
+	}
+
+	template <>
+	inline double randomGene<double>()
+	{
+		return getRandom().uniformReal();
+	}
+
+	/**
+	 *	@brief	Specimen with random genes, genome length is set with setGenomeLength()
+	 */
+	template <typename GeneType>
+	class RandomSpecimen : public IdentitySpecimen<GeneType>
+	{
+	private:
+		static size_t& genomeLength()
+		{
+			static size_t genome_length = 0;
+			return genome_length;
+		}
+
+	public:
+		RandomSpecimen()
+		{
+			this->dna_.reserve(genomeLength());
+			for (size_t i = 0; i < genomeLength(); ++i)
+				this->dna_.push_back(randomGene<GeneType>());
+		}
+
+		static void setGenomeLength(size_t genome_length) { genomeLength() = genome_length; }
+	};
+
+	/**
+	 *	@brief	Specimen with N random genes stored inline
+	 */
+	template <typename GeneType, size_t N>
+	class RandomFixedSpecimen : public FixedIdentitySpecimen<GeneType, N>
+	{
+	public:
+		RandomFixedSpecimen()
+		{
+			for (auto& gene : this->dna_)
+				gene = randomGene<GeneType>();
+		}
+	};
+
+	/**
+	 *	@brief	Sum of genes, counts its calls
+	 */
+	template <typename SpecimenType>
+	class SumFitness
+	{
+	private:
+		std::atomic<size_t>* evaluations_;
+
+	public:
+		explicit SumFitness(std::atomic<size_t>& evaluations) : evaluations_(&evaluations) { }
+
+		double operator()(const SpecimenType& specimen) const
+		{
+			evaluations_->fetch_add(1, std::memory_order_relaxed);
+
+			double result = 0.0;
+			for (auto gene : specimen.getFenotypeView())
+				result += gene;
+
+			return result;
+		}
+	};
+
+	/**
+	 *	@brief	Sum of genes evaluated in batches, counts evaluated members
+	 */
+	template <typename SpecimenType>
+	class BatchSumFitness : public BatchFitness<SpecimenType>
+	{
+	private:
+		std::atomic<size_t>* evaluations_;
+
+	public:
+		explicit BatchSumFitness(std::atomic<size_t>& evaluations) : evaluations_(&evaluations) { }
+
+		void evaluateBatch(const SpecimenType* members, size_t count, double* fitness) const override
+		{
+			evaluations_->fetch_add(count, std::memory_order_relaxed);
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				double result = 0.0;
+				for (auto gene : members[i].getFenotypeView())
+					result += gene;
+
+				fitness[i] = result;
+			}
+		}
+	};
+
+	/**
+	 *	@brief	Population with fitness drawn uniformly from [0, 100)
+	 */
+	template <typename SpecimenType>
+	std::vector<SpecimenType> makeEvaluatedPopulation(size_t size)
+	{
+		Random random(0);
+
+		std::vector<SpecimenType> population(size);
+		for (auto& member : population)
+			member.setFitness(random.uniformReal() * 100.0);
+
+		return population;
+	}
+
+}
+}
+
+#endif // !__BENCHMARK_COMMON__
@@ -0,0 +1,90 @@
+/**
+ *	Measures number of heap allocations per generation of environment
+ *	with and without recycling of population buffers
+ *
+ *	Authors: Michal Swiatek, Michal Sulek
+ *	Update:	 17.10.2026
+ *
+ *	Github repository: https://github.com/MichalKonradSulek/ZPR
+ */
+
+#include "../ga.hpp"
+#include "allocation_counter.hpp"
+
+#include <iostream>
+#include <cstdlib>
+
+const size_t GENOME_LENGTH		= 1000;
+const size_t POPULATION_SIZE	= 1000;
+
+const int WARM_UP_GENERATIONS	= 5;
+const int MEASURED_GENERATIONS	= 50;
+
+class IntSpecimen : public ga::IdentitySpecimen<int>
+{
+public:
+	IntSpecimen()
+	{
+		dna_.reserve(GENOME_LENGTH);
+		for (size_t i = 0; i < GENOME_LENGTH; ++i)
+			dna_.push_back(ga::getRandom().uniform(GENOME_LENGTH));
+	}
+};
+
+template <template <typename T> typename SelectionType, typename... Args>
+double allocationsPerGeneration(bool recycle_buffers, Args&&... args)
+{
+	auto fitness = [](const IntSpecimen& specimen)
+	{
+		double result = 0.0;
+		for (auto gene : specimen.getFenotypeView())
+			result += gene;
+
+		return result;
+	};
+
+	ga::Environment<IntSpecimen> env(POPULATION_SIZE);
+
+	env.setMutationType<ga::SwapGeneMutation>(-1, ga::MUTATION_CHANCE_PERCENT * 10, 5);
+	env.setCrossoverType<ga::SinglePointCrossover>();
+	env.setSelectionType<SelectionType>(std::forward<Args>(args)...);
+	env.setBufferRecycling(recycle_buffers);
+
+	auto neverFinish = [](const auto&) { return false; };
+	env.runSimulation(fitness, neverFinish, WARM_UP_GENERATIONS, false);
+
+	size_t before = ga::benchmark::getAllocationCount();
+
+	for (int i = 0; i < MEASURED_GENERATIONS; ++i)
+		env.iteration(fitness, false);
+
+	return double(ga::benchmark::getAllocationCount() - before) / MEASURED_GENERATIONS;
+}
+
+int main()
+{
+	ga::getRandom().setSeed(0);
+
+	std::cout << "Heap allocations per generation (population " << POPULATION_SIZE << ", genome " << GENOME_LENGTH << ")\n";
+	std::cout << "selection\tdefault\trecycled buffers\n";
+
+	double recycled_total = 0.0;
+
+	double plain = allocationsPerGeneration<ga::RouletteWheelSelection>(false);
+	double recycled = allocationsPerGeneration<ga::RouletteWheelSelection>(true);
+	recycled_total += recycled;
+	std::cout << "roulette\t" << plain << '\t' << recycled << '\n';
+
+	plain = allocationsPerGeneration<ga::TournamentSelection>(false, 4);
+	recycled = allocationsPerGeneration<ga::TournamentSelection>(true, 4);
+	recycled_total += recycled;
+	std::cout << "tournament\t" << plain << '\t' << recycled << '\n';
+
+	plain = allocationsPerGeneration<ga::RankSelection>(false);
+	recycled = allocationsPerGeneration<ga::RankSelection>(true);
+	recycled_total += recycled;
+	std::cout << "rank\t\t" << plain << '\t' << recycled << '\n';
+
+	//	Steady-state generations with recycled buffers are expected to be allocation free
+	return recycled_total == 0.0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
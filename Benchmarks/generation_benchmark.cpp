@@ -0,0 +1,218 @@
+/**
+ *	Benchmarks of full generations of Environment across population
+ *	sizes, genome lengths and gene types. Besides time per generation
+ *	heap allocations per generation and evaluations per second are
+ *	reported as counters
+ *
+ *	Authors: Michal Swiatek, Michal Sulek
+ *	Update:	 17.10.2026
+ *
+ *	Github repository: https://github.com/MichalKonradSulek/ZPR
+ */
+
+#include "benchmark_common.hpp"
+#include "allocation_counter.hpp"
+
+#include <benchmark/benchmark.h>
+
+namespace {
+
+	using ga::benchmark::RandomSpecimen;
+	using ga::benchmark::RandomFixedSpecimen;
+	using ga::benchmark::SumFitness;
+
+	using ga::benchmark::BatchSumFitness;
+
+	/**
+	 *	Measures generations of prepared environment, reports allocations and evaluations
+	 */
+	template <typename EnvironmentType, typename FitnessFunction>
+	void measureGenerations(benchmark::State& state, EnvironmentType& env, FitnessFunction& fitness, std::atomic<size_t>& evaluations)
+	{
+		//	Warm up, so that recycled buffers reach their steady state
+		env.evaluate(fitness);
+		for (int i = 0; i < 3; ++i)
+			env.iteration(fitness, false);
+
+		evaluations = 0;
+		size_t allocations = ga::benchmark::getAllocationCount();
+
+		for (auto _ : state)
+			env.iteration(fitness, false);
+
+		allocations = ga::benchmark::getAllocationCount() - allocations;
+
+		state.counters["allocations"] = benchmark::Counter(double(allocations), benchmark::Counter::kAvgIterations);
+		state.counters["evaluations"] = benchmark::Counter(double(evaluations.load()), benchmark::Counter::kIsRate);
+	}
+
+	/**
+	 *	Arguments: population size, genome length, buffer recycling
+	 */
+	template <typename GeneType, template <typename T> typename SelectionType, typename... Args>
+	void BM_Generation(benchmark::State& state, Args... args)
+	{
+		using SpecimenType = RandomSpecimen<GeneType>;
+
+		SpecimenType::setGenomeLength(state.range(1));
+
+		ga::getRandom().setSeed(0);
+		ga::Environment<SpecimenType> env(state.range(0));
+
+		env.template setSelectionType<SelectionType>(args...);
+		env.template setMutationType<ga::SwapGeneMutation>(-1, ga::MUTATION_CHANCE_PERCENT * 10, 5);
+		env.template setCrossoverType<ga::SinglePointCrossover>();
+		env.setBufferRecycling(state.range(2) != 0);
+
+		std::atomic<size_t> evaluations(0);
+		SumFitness<SpecimenType> fitness(evaluations);
+
+		measureGenerations(state, env, fitness, evaluations);
+	}
+
+	/**
+	 *	Same generation as BM_Generation<int, RouletteWheelSelection> with population
+	 *	evaluated by BatchFitness. Arguments: population size, genome length, buffer recycling
+	 */
+	void BM_BatchGeneration(benchmark::State& state)
+	{
+		using SpecimenType = RandomSpecimen<int>;
+
+		SpecimenType::setGenomeLength(state.range(1));
+
+		ga::getRandom().setSeed(0);
+		ga::Environment<SpecimenType> env(state.range(0));
+
+		env.template setMutationType<ga::SwapGeneMutation>(-1, ga::MUTATION_CHANCE_PERCENT * 10, 5);
+		env.setBufferRecycling(state.range(2) != 0);
+
+		std::atomic<size_t> evaluations(0);
+		BatchSumFitness<SpecimenType> fitness(evaluations);
+
+		measureGenerations(state, env, fitness, evaluations);
+	}
+
+	/**
+	 *	Same generation as BM_Generation<int, RouletteWheelSelection> with operators
+	 *	composed at compile time. Arguments: population size, genome length, buffer recycling
+	 */
+	void BM_StaticGeneration(benchmark::State& state)
+	{
+		using SpecimenType = RandomSpecimen<int>;
+		using EnvironmentType = ga::StaticEnvironment<SpecimenType,
+													  ga::SwapGeneMutation<int>,
+													  ga::SinglePointCrossover<int>,
+													  ga::RouletteWheelSelection<SpecimenType> >;
+
+		SpecimenType::setGenomeLength(state.range(1));
+
+		ga::getRandom().setSeed(0);
+		EnvironmentType env(state.range(0), ga::SwapGeneMutation<int>(-1, ga::MUTATION_CHANCE_PERCENT * 10, 5));
+
+		env.setBufferRecycling(state.range(2) != 0);
+
+		std::atomic<size_t> evaluations(0);
+		SumFitness<SpecimenType> fitness(evaluations);
+
+		measureGenerations(state, env, fitness, evaluations);
+	}
+
+	/**
+	 *	Same generation as BM_Generation<int, RouletteWheelSelection> with genome of
+	 *	length N stored in std::array. Arguments: population size, buffer recycling
+	 */
+	template <size_t N>
+	void BM_FixedGeneration(benchmark::State& state)
+	{
+		using SpecimenType = RandomFixedSpecimen<int, N>;
+
+		ga::getRandom().setSeed(0);
+		ga::Environment<SpecimenType> env(state.range(0));
+
+		env.template setMutationType<ga::SwapGeneMutation>(-1, ga::MUTATION_CHANCE_PERCENT * 10, 5);
+		env.setBufferRecycling(state.range(1) != 0);
+
+		std::atomic<size_t> evaluations(0);
+		SumFitness<SpecimenType> fitness(evaluations);
+
+		measureGenerations(state, env, fitness, evaluations);
+	}
+
+	/**
+	 *	Same generation as BM_Generation<int, RouletteWheelSelection> with population
+	 *	stored in gene matrices. Arguments: population size, genome length
+	 */
+	void BM_MatrixGeneration(benchmark::State& state)
+	{
+		ga::getRandom().setSeed(0);
+		ga::MatrixEnvironment<int> env(state.range(0), state.range(1));
+
+		env.generatePopulation([](ga::GeneRow<int>& genes)
+		{
+			for (auto& gene : genes)
+				gene = ga::benchmark::randomGene<int>();
+		});
+		env.setMutationType<ga::SwapGeneMutation>(-1, ga::MUTATION_CHANCE_PERCENT * 10, 5);
+
+		std::atomic<size_t> evaluations(0);
+		SumFitness<ga::MatrixSpecimen<int> > fitness(evaluations);
+
+		measureGenerations(state, env, fitness, evaluations);
+	}
+
+	void BM_TournamentGeneration(benchmark::State& state)
+	{
+		BM_Generation<int, ga::TournamentSelection>(state, size_t(4));
+	}
+
+	void generationArguments(benchmark::internal::Benchmark* benchmark)
+	{
+		benchmark->ArgNames({ "population", "genome", "recycle" });
+
+		for (int population : { 100, 1000, 10000 })
+		{
+			for (int genome : { 16, 256, 2048 })
+			{
+				for (int recycle : { 0, 1 })
+					benchmark->Args({ population, genome, recycle });
+			}
+		}
+	}
+
+	void fixedArguments(benchmark::internal::Benchmark* benchmark)
+	{
+		benchmark->ArgNames({ "population", "recycle" });
+
+		for (int population : { 100, 1000, 10000 })
+		{
+			for (int recycle : { 0, 1 })
+				benchmark->Args({ population, recycle });
+		}
+	}
+
+	void matrixArguments(benchmark::internal::Benchmark* benchmark)
+	{
+		benchmark->ArgNames({ "population", "genome" });
+
+		for (int population : { 100, 1000, 10000 })
+		{
+			for (int genome : { 16, 256, 2048 })
+				benchmark->Args({ population, genome });
+		}
+	}
+
+}
+
+BENCHMARK_TEMPLATE(BM_Generation, bool, ga::RouletteWheelSelection)->Apply(generationArguments)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_Generation, char, ga::RouletteWheelSelection)->Apply(generationArguments)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_Generation, int, ga::RouletteWheelSelection)->Apply(generationArguments)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_Generation, double, ga::RouletteWheelSelection)->Apply(generationArguments)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_BatchGeneration)->Apply(generationArguments)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_StaticGeneration)->Apply(generationArguments)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_FixedGeneration, 16)->Apply(fixedArguments)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_FixedGeneration, 256)->Apply(fixedArguments)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_MatrixGeneration)->Apply(matrixArguments)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(BM_Generation, int, ga::RankSelection)->Apply(generationArguments)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_TournamentGeneration)->Apply(generationArguments)->Unit(benchmark::kMicrosecond);
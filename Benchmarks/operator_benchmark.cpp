@@ -0,0 +1,212 @@
+/**
+ *	Microbenchmarks of predefined mutations and crossovers across
+ *	genome lengths and gene types, permutation crossovers are
+ *	measured on random permutations, real-coded operators on genes
+ *	from [0, 1) (configure with GA_ENABLE_AVX2 to measure AVX2 kernels)
+ *
+ *	Authors: Michal Swiatek, Michal Sulek
+ *	Update:	 17.10.2026
+ *
+ *	Github repository: https://github.com/MichalKonradSulek/ZPR
+ */
+
+#include "benchmark_common.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <numeric>
+#include <algorithm>
+
+namespace {
+
+	using ga::benchmark::randomGene;
+
+	template <typename GeneType>
+	std::vector<GeneType> makeGenotype(size_t length)
+	{
+		std::vector<GeneType> genotype;
+		genotype.reserve(length);
+
+		for (size_t i = 0; i < length; ++i)
+			genotype.push_back(randomGene<GeneType>());
+
+		return genotype;
+	}
+
+	template <typename MutationType>
+	void BM_Mutation(benchmark::State& state)
+	{
+		using Gene = typename MutationType::Gene;
+
+		auto genotype = makeGenotype<Gene>(state.range(0));
+
+		//	Mutation chance 100%, every call mutates
+		MutationType mutation(-1, ga::MAX_MUTATION_CHANCE);
+
+		for (auto _ : state)
+		{
+			mutation.mutate(genotype);
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations());
+	}
+
+	//	Per gene rate is given in millionths as second argument
+	template <typename MutationType>
+	void BM_PerGeneMutation(benchmark::State& state)
+	{
+		ga::BitGenotype genotype(state.range(0), false);
+
+		MutationType mutation(state.range(1) * 1e-6);
+
+		for (auto _ : state)
+		{
+			mutation.mutate(genotype);
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations());
+	}
+
+	template <typename CrossoverType, typename... Args>
+	void BM_Crossover(benchmark::State& state, Args... args)
+	{
+		using Gene = typename CrossoverType::Gene;
+
+		auto parentA = makeGenotype<Gene>(state.range(0));
+		auto parentB = makeGenotype<Gene>(state.range(0));
+
+		CrossoverType crossover(args...);
+
+		for (auto _ : state)
+		{
+			crossover.cross(parentA, parentB);
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations());
+	}
+
+	//	Real-coded operators on genes from [0, 1), arguments: genome length
+	template <typename MutationType, typename... Args>
+	void BM_RealMutation(benchmark::State& state, Args... args)
+	{
+		auto genotype = makeGenotype<double>(state.range(0));
+
+		MutationType mutation(args...);
+
+		for (auto _ : state)
+		{
+			mutation.mutate(genotype);
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	void BM_GaussianMutation(benchmark::State& state)
+	{
+		BM_RealMutation<ga::GaussianMutation<double> >(state, 0.01, 0.0, 1.0);
+	}
+
+	void BM_PolynomialMutation(benchmark::State& state)
+	{
+		BM_RealMutation<ga::PolynomialMutation<double> >(state, 0.0, 1.0);
+	}
+
+	template <typename CrossoverType, typename... Args>
+	void BM_RealCrossover(benchmark::State& state, Args... args)
+	{
+		auto parentA = makeGenotype<double>(state.range(0));
+		auto parentB = makeGenotype<double>(state.range(0));
+
+		CrossoverType crossover(args...);
+
+		for (auto _ : state)
+		{
+			crossover.cross(parentA, parentB);
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	void BM_ArithmeticCrossover(benchmark::State& state)
+	{
+		BM_RealCrossover<ga::ArithmeticCrossover<double> >(state);
+	}
+
+	void BM_BlendCrossover(benchmark::State& state)
+	{
+		BM_RealCrossover<ga::BlendCrossover<double> >(state, 0.5, 0.0, 1.0);
+	}
+
+	void BM_SimulatedBinaryCrossover(benchmark::State& state)
+	{
+		BM_RealCrossover<ga::SimulatedBinaryCrossover<double> >(state, 15.0, 0.0, 1.0);
+	}
+
+	void BM_MultiplePointCrossover(benchmark::State& state)
+	{
+		BM_Crossover<ga::MultiplePointCrossover<int> >(state, 4);
+	}
+
+	template <typename CrossoverType>
+	void BM_PermutationCrossover(benchmark::State& state)
+	{
+		std::vector<int> parentA(state.range(0));
+		std::iota(parentA.begin(), parentA.end(), 0);
+
+		std::vector<int> parentB = parentA;
+		std::shuffle(parentA.begin(), parentA.end(), ga::getRandom());
+		std::shuffle(parentB.begin(), parentB.end(), ga::getRandom());
+
+		CrossoverType crossover;
+
+		for (auto _ : state)
+		{
+			crossover.cross(parentA, parentB);
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations());
+	}
+
+}
+
+#define GENOME_LENGTHS RangeMultiplier(8)->Range(16, 8192)
+
+BENCHMARK_TEMPLATE(BM_Mutation, ga::SwapGeneMutation<bool>)->GENOME_LENGTHS;
+BENCHMARK_TEMPLATE(BM_Mutation, ga::SwapGeneMutation<char>)->GENOME_LENGTHS;
+BENCHMARK_TEMPLATE(BM_Mutation, ga::SwapGeneMutation<int>)->GENOME_LENGTHS;
+BENCHMARK_TEMPLATE(BM_Mutation, ga::SwapGeneMutation<double>)->GENOME_LENGTHS;
+
+BENCHMARK_TEMPLATE(BM_Mutation, ga::InverseGenesMutation<char>)->GENOME_LENGTHS;
+BENCHMARK_TEMPLATE(BM_Mutation, ga::InverseGenesMutation<int>)->GENOME_LENGTHS;
+BENCHMARK_TEMPLATE(BM_Mutation, ga::ScrambleGenesMutation<int>)->GENOME_LENGTHS;
+BENCHMARK_TEMPLATE(BM_Mutation, ga::ScrambleGenesMutation<double>)->GENOME_LENGTHS;
+
+BENCHMARK_TEMPLATE(BM_PerGeneMutation, ga::PackedPerGeneFlipBitMutation)
+	->ArgNames({"genome", "rate_ppm"})->ArgsProduct({ { 1 << 10, 1 << 15, 1 << 20 }, { 10, 10000 } });
+
+BENCHMARK_TEMPLATE(BM_Crossover, ga::SinglePointCrossover<bool>)->GENOME_LENGTHS;
+BENCHMARK_TEMPLATE(BM_Crossover, ga::SinglePointCrossover<char>)->GENOME_LENGTHS;
+BENCHMARK_TEMPLATE(BM_Crossover, ga::SinglePointCrossover<int>)->GENOME_LENGTHS;
+BENCHMARK_TEMPLATE(BM_Crossover, ga::SinglePointCrossover<double>)->GENOME_LENGTHS;
+
+BENCHMARK_TEMPLATE(BM_Crossover, ga::UniformCrossover<bool>)->GENOME_LENGTHS;
+BENCHMARK_TEMPLATE(BM_Crossover, ga::UniformCrossover<int>)->GENOME_LENGTHS;
+
+BENCHMARK(BM_MultiplePointCrossover)->GENOME_LENGTHS;
+
+BENCHMARK_TEMPLATE(BM_PermutationCrossover, ga::OrderCrossover<int>)->GENOME_LENGTHS;
+BENCHMARK_TEMPLATE(BM_PermutationCrossover, ga::PartiallyMappedCrossover<int>)->GENOME_LENGTHS;
+BENCHMARK_TEMPLATE(BM_PermutationCrossover, ga::CycleCrossover<int>)->GENOME_LENGTHS;
+BENCHMARK_TEMPLATE(BM_PermutationCrossover, ga::EdgeRecombinationCrossover<int>)->GENOME_LENGTHS;
+
+BENCHMARK(BM_GaussianMutation)->GENOME_LENGTHS;
+BENCHMARK(BM_PolynomialMutation)->GENOME_LENGTHS;
+BENCHMARK(BM_ArithmeticCrossover)->GENOME_LENGTHS;
+BENCHMARK(BM_BlendCrossover)->GENOME_LENGTHS;
+BENCHMARK(BM_SimulatedBinaryCrossover)->GENOME_LENGTHS;
@@ -0,0 +1,88 @@
+/**
+ *	Microbenchmarks of selections for populations of 1k - 1M individuals,
+ *	comparing fitness proportional selections (roulette wheel with binary
+ *	search over cumulative fitness and alias method) with rank based ones
+ *
+ *	Authors: Michal Swiatek, Michal Sulek
+ *	Update:	 17.10.2026
+ *
+ *	Github repository: https://github.com/MichalKonradSulek/ZPR
+ */
+
+#include "benchmark_common.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdlib>
+
+namespace {
+
+	using EmptySpecimen = ga::IdentitySpecimen<int>;
+
+	using Population = std::vector<EmptySpecimen>;
+
+	template <typename SelectionType, typename... Args>
+	void BM_Selection(benchmark::State& state, Args... args)
+	{
+		size_t size = state.range(0);
+
+		Population population = ga::benchmark::makeEvaluatedPopulation<EmptySpecimen>(size);
+		SelectionType selection(args...);
+		ga::Selection<EmptySpecimen>::Indices indices;
+
+		for (auto _ : state)
+		{
+			selection.selectIndices(population, size, indices);
+			benchmark::DoNotOptimize(indices.data());
+		}
+
+		state.SetItemsProcessed(state.iterations() * size);
+	}
+
+	/**
+	 *	Selection scanning fitness column kept by environment instead of Specimens
+	 */
+	template <typename SelectionType, typename... Args>
+	void BM_SelectionByFitness(benchmark::State& state, Args... args)
+	{
+		size_t size = state.range(0);
+
+		Population population = ga::benchmark::makeEvaluatedPopulation<EmptySpecimen>(size);
+		std::vector<double> fitness(size);
+		for (size_t i = 0; i < size; ++i)
+			fitness[i] = population[i].getFitness();
+
+		SelectionType selection(args...);
+		ga::Selection<EmptySpecimen>::Indices indices;
+
+		for (auto _ : state)
+		{
+			selection.selectByFitness(population, fitness.data(), size, indices);
+			benchmark::DoNotOptimize(indices.data());
+		}
+
+		state.SetItemsProcessed(state.iterations() * size);
+	}
+
+	void BM_TournamentSelection(benchmark::State& state)
+	{
+		BM_Selection<ga::TournamentSelection<EmptySpecimen> >(state, size_t(4));
+	}
+
+	void BM_TournamentSelectionByFitness(benchmark::State& state)
+	{
+		BM_SelectionByFitness<ga::TournamentSelection<EmptySpecimen> >(state, size_t(4));
+	}
+
+}
+
+BENCHMARK_TEMPLATE(BM_Selection, ga::RouletteWheelSelection<EmptySpecimen>)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_Selection, ga::StochasticUniversalSamplingSelection<EmptySpecimen>)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_Selection, ga::AliasSelection<EmptySpecimen>)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_Selection, ga::RankSelection<EmptySpecimen>)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_Selection, ga::BestFitnessPercentageSelection<EmptySpecimen>)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK(BM_TournamentSelection)->RangeMultiplier(10)->Range(1000, 1000000);
+
+BENCHMARK_TEMPLATE(BM_SelectionByFitness, ga::RouletteWheelSelection<EmptySpecimen>)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_SelectionByFitness, ga::RankSelection<EmptySpecimen>)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK(BM_TournamentSelectionByFitness)->RangeMultiplier(10)->Range(1000, 1000000);
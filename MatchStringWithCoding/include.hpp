@@ -12,31 +12,46 @@ std::string str1 = "This is the string I'm trying to evolve!";
 
 const size_t GENES_PER_CHROMOSOME = 7;
 
-class MySpecimen : public ga::Specimen<bool, char>
+class MySpecimen : public ga::Specimen<bool, char, ga::BitGenotype>
 {
 public:
 	MySpecimen()
 	{
 		dna_.resize(str1.size() * GENES_PER_CHROMOSOME);
-		for (auto&& c : dna_)
-			c = rand() % 2;
+		for (size_t i = 0; i < dna_.size(); ++i)
+			dna_.set(i, ga::getRandom().uniform(2));
 	}
 
 	Fenotype getFenotype() const override
 	{
 		Fenotype result;
-		result.reserve(dna_.size());
+		decodeFenotype(result);
+
+		return result;
+	}
+
+	void print() const
+	{
+		const auto& fenotype = getFenotypeView();
+		std::cout << std::string(fenotype.begin(), fenotype.end()) << "\tfitness: " << getFitness() << '\n';
+	}
+
+protected:
+	void decodeFenotype(Fenotype& result) const override
+	{
+		result.clear();
+		result.reserve(dna_.size() / GENES_PER_CHROMOSOME);
 
 		size_t counter = 0;
 		char chromosome = 0;
 
-		for (const auto& gene : dna_)
+		for (size_t i = 0; i < dna_.size(); ++i)
 		{
 			chromosome *= 2;
-			gene ? ++chromosome : chromosome;
+			dna_[i] ? ++chromosome : chromosome;
 			++counter;
 
-			if (counter >= 7)
+			if (counter >= GENES_PER_CHROMOSOME)
 			{
 				result.push_back(chromosome);
 
@@ -44,14 +59,6 @@ public:
 				counter = 0;
 			}
 		}
-
-		return result;
-	}
-
-	void print() const
-	{
-		auto fenotype = getFenotype();
-		std::cout << std::string(fenotype.begin(), fenotype.end()) << "\tfitness: " << getFitness() << '\n';
 	}
 };
 
@@ -1,14 +1,11 @@
 #include "include.hpp"
 
 int main() {
-	srand(time(nullptr));
+	ga::getRandom().setSeed(time(nullptr));
 
-	auto finishCondition = [](const auto& population)
+	auto finishCondition = [](const auto& population, const ga::GenerationStats& stats)
 	{
-		ga::SpecimenComp<MySpecimen> comp;
-
-		auto it = std::max_element(population.begin(), population.end(), comp);
-		auto fenotype = (*it).getFenotype();
+		const auto& fenotype = population[stats.best_index].getFenotypeView();
 
 		return str1 == std::string(fenotype.begin(), fenotype.end());
 	};
@@ -16,7 +13,7 @@ int main() {
 	auto fitness = [](const MySpecimen& specimen)
 	{
 		double result = 0;
-		const auto& fenotype = specimen.getFenotype();
+		const auto& fenotype = specimen.getFenotypeView();
 
 		for (size_t i = 0; i < str1.size(); i++)
 		{
@@ -29,13 +26,13 @@ int main() {
 
 	ga::Environment<MySpecimen>  env(5000);
 
-	env.setMutationType<ga::FlipBitMutation>(ga::MUTATION_CHANCE_PERCENT * 0.05, 100, 5);
+	env.setMutationType<ga::PackedFlipBitMutation>(ga::MUTATION_CHANCE_PERCENT * 0.05, 100, 5);
 	env.setCrossoverType<ga::SinglePointCrossover>();
 	env.setSelectionType<ga::RankSelection>();
 
 	env.runSimulation(fitness, finishCondition, -1, false);
 
-	auto fenotype = env.getBest().getFenotype();
+	const auto& fenotype = env.getBest().getFenotypeView();
 
 	std::cout << std::string(fenotype.begin(), fenotype.end()) << '\n';
 
@@ -11,7 +11,7 @@
 
 std::string str = "This is another string that I'm trying to evolve!";
 
-class MySpecimen : public ga::Specimen<char, char>
+class MySpecimen : public ga::IdentitySpecimen<char>
 {
 public:
 	MySpecimen()
@@ -19,17 +19,12 @@ public:
 		dna_.reserve(str.length());
 
 		for (size_t i = 0; i < str.length(); ++i)
-			dna_.push_back(rand() % 96 + 32);
-	}
-
-	Fenotype getFenotype() const override
-	{
-		return dna_;
+			dna_.push_back(ga::getRandom().uniform(96) + 32);
 	}
 
 	void print() const
 	{
-		auto fenotype = getFenotype();
+		const auto& fenotype = getFenotypeView();
 		std::cout << std::string(fenotype.begin(), fenotype.end()) << "\tfitness: " << getFitness() << '\n';
 	}
 };
@@ -46,13 +41,13 @@ private:
 	int	generations_;
 
 public:
-	explicit SpecimenPair(size_t max_generations = 10) : generations_(rand() % max_generations + 1)
+	explicit SpecimenPair(size_t max_generations = 10) : generations_(ga::getRandom().uniform(max_generations) + 1)
 	{
 		first	= MySpecimen();
 		second	= MySpecimen();
 	}
 
-	SpecimenPair(const MySpecimen& mate1, const MySpecimen& mate2, size_t max_generations = 10) : generations_(rand() % max_generations + 1)
+	SpecimenPair(const MySpecimen& mate1, const MySpecimen& mate2, size_t max_generations = 10) : generations_(ga::getRandom().uniform(max_generations) + 1)
 	{
 		first  = mate1;
 		second = mate2;
@@ -99,16 +94,16 @@ public:
 
 	void performMutation(Genotype& genes) const override
 	{
-		int choice = rand() % genes.size();
+		size_t choice = ga::getRandom().uniform(genes.size());
 
-		genes[choice] = rand() % 96 + 32;
+		genes[choice] = ga::getRandom().uniform(96) + 32;
 	}
 };
 
 class MyEnvironment : public ga::Environment<SpecimenPair>
 {
 private:
-	void crossover() override
+	void crossover(ga::Executor&) override
 	{
 		/*for (auto& child : mating_pool_)
 		{
@@ -128,7 +123,7 @@ private:
 		offspring_ = mating_pool_;
 	}
 
-	void mutation() override
+	void mutation(ga::Executor&) override
 	{
 		for (auto& child : offspring_)
 		{
@@ -155,7 +150,7 @@ private:
 				offspring_[i].generationPassed();
 		}
 
-		std::random_shuffle(individuals.begin(), individuals.end());
+		std::shuffle(individuals.begin(), individuals.end(), ga::getRandom());
 
 		for (int i = 0; i < (int)individuals.size() - 1; i += 2)
 			offspring_.push_back(SpecimenPair(individuals[i], individuals[i + 1]));
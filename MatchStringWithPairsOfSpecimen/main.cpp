@@ -1,13 +1,13 @@
 #include "include.hpp"
 
 int main() {
-	srand(time(nullptr));
+	ga::getRandom().setSeed(time(nullptr));
 
 	//	Fitness for individual
 	auto fitness = [](const MySpecimen& specimen)
 	{
 		double result = 0;
-		const auto& fenotype = specimen.getFenotype();
+		const auto& fenotype = specimen.getFenotypeView();
 
 		for (size_t i = 0; i < str.size(); i++)
 		{
@@ -32,13 +32,9 @@ int main() {
 		return result;
 	};
 
-	auto finishCondition = [](const auto& population)
+	auto finishCondition = [](const auto&, const ga::GenerationStats& stats)
 	{
-		ga::SpecimenComp<SpecimenPair> comp;
-
-		auto it = std::max_element(population.begin(), population.end(), comp);
-
-		return (*it).getFitness() == str.length() * 10 * 2;	//	Length of string * fitness score * 2 individuals
+		return stats.best == str.length() * 10 * 2;	//	Length of string * fitness score * 2 individuals
 	};
 
 	MyEnvironment env(1000);
@@ -15,6 +15,8 @@
 #include <algorithm>
 
 #include "crossover.hpp"
+#include "random.hpp"
+#include "bit_genotype.hpp"
 
 namespace ga {
 
@@ -24,17 +26,30 @@ namespace ga {
 	 *	@details Crossover point is randomly picked, then all genes
 	 *			 after that crossover point get swapped with other parent
 	 */
-	template <typename GeneType>
-	class SinglePointCrossover : public Crossover<GeneType>
+	template <typename GeneType, typename GenotypeType = std::vector<GeneType> >
+	class SinglePointCrossover : public Crossover<GeneType, GenotypeType>
 	{
 	public:
-		using Gene = typename Crossover<GeneType>::Gene;
-		using Genotype = typename Crossover<GeneType>::Genotype;
+		using Gene = typename Crossover<GeneType, GenotypeType>::Gene;
+		using Genotype = typename Crossover<GeneType, GenotypeType>::Genotype;
+		using Changes = typename Crossover<GeneType, GenotypeType>::Changes;
 
 		void cross(Genotype& parentA, Genotype& parentB) override
 		{
-			size_t crossover_point = rand() % parentA.size();
+			Changes untracked;
+			crossTracked(parentA, parentB, untracked, untracked);
+		}
+
+		bool crossTracked(Genotype& parentA, Genotype& parentB, Changes& changesA, Changes& changesB) override
+		{
+			size_t crossover_point = getRandom().uniform(parentA.size());
+
+			changesA.record(parentA, crossover_point, parentA.size());
+			changesB.record(parentB, crossover_point, parentB.size());
+
 			std::swap_ranges(parentA.begin() + crossover_point, parentA.end(), parentB.begin() + crossover_point);
+
+			return true;
 		}
 	};
 
@@ -44,12 +59,13 @@ namespace ga {
 	 *	@details Crossover points are randomly picked, then genes are
 	 *			 crossed between each non-overlaping section
 	 */
-	template <typename GeneType>
-	class MultiplePointCrossover : public Crossover<GeneType>
+	template <typename GeneType, typename GenotypeType = std::vector<GeneType> >
+	class MultiplePointCrossover : public Crossover<GeneType, GenotypeType>
 	{
 	public:
-		using Gene = typename Crossover<GeneType>::Gene;
-		using Genotype = typename Crossover<GeneType>::Genotype;
+		using Gene = typename Crossover<GeneType, GenotypeType>::Gene;
+		using Genotype = typename Crossover<GeneType, GenotypeType>::Genotype;
+		using Changes = typename Crossover<GeneType, GenotypeType>::Changes;
 
 		MultiplePointCrossover() = delete;
 		explicit MultiplePointCrossover(int number_of_points) : number_of_points_(number_of_points) { }
@@ -57,17 +73,31 @@ namespace ga {
 
 		void cross(Genotype& parentA, Genotype& parentB) override
 		{
-			std::vector<int> crossover_points;
-			crossover_points.reserve(number_of_points_);
+			Changes untracked;
+			crossTracked(parentA, parentB, untracked, untracked);
+		}
+
+		bool crossTracked(Genotype& parentA, Genotype& parentB, Changes& changesA, Changes& changesB) override
+		{
+			//	Reused between calls, so crossing doesn't allocate after first call on a thread
+			thread_local std::vector<int> crossover_points;
+			crossover_points.clear();
 
 			for (int i = 0; i < number_of_points_; ++i)
-				crossover_points.emplace_back(rand() % parentA.size());
+				crossover_points.emplace_back(int(getRandom().uniform(parentA.size())));
 
 			std::sort(crossover_points.begin(), crossover_points.end());
 
 			for (int i = 0; i < number_of_points_ - 1; i += 2)
+			{
+				changesA.record(parentA, crossover_points[i], crossover_points[i + 1]);
+				changesB.record(parentB, crossover_points[i], crossover_points[i + 1]);
+
 				std::swap_ranges(parentA.begin() + crossover_points[i], parentA.begin() + crossover_points[i + 1], 
 								 parentB.begin() + crossover_points[i]);
+			}
+
+			return true;
 		}
 
 	protected:
@@ -79,34 +109,118 @@ namespace ga {
 	 *
 	 *	@details For ech gene of parents there is a 50% chance to be crossed
 	 */
-	template <typename GeneType>
-	class UniformCrossover : public Crossover<GeneType>
+	template <typename GeneType, typename GenotypeType = std::vector<GeneType> >
+	class UniformCrossover : public Crossover<GeneType, GenotypeType>
 	{
 	public:
-		using Gene = typename Crossover<GeneType>::Gene;
-		using Genotype = typename Crossover<GeneType>::Genotype;
+		using Gene = typename Crossover<GeneType, GenotypeType>::Gene;
+		using Genotype = typename Crossover<GeneType, GenotypeType>::Genotype;
+		using Changes = typename Crossover<GeneType, GenotypeType>::Changes;
 
 		void cross(Genotype& parentA, Genotype& parentB) override
 		{
+			Random& random = getRandom();
+			uint64_t bits = 0;
+
 			for (size_t i = 0; i < parentA.size(); ++i)
 			{
-				if (rand() % 2 == 0)
-					std::swap(parentA[i], parentB[i]);
+				//	One random number decides about 64 genes
+				if (i % 64 == 0)
+					bits = random();
+
+				if (bits & 1)
+				{
+					using std::swap;
+					swap(parentA[i], parentB[i]);
+				}
+
+				bits >>= 1;
 			}
 		}
 	};
 
-	template <typename GeneType>
-	class NoCrossover : public Crossover<GeneType>
+	template <typename GeneType, typename GenotypeType = std::vector<GeneType> >
+	class NoCrossover : public Crossover<GeneType, GenotypeType>
 	{
 	public:
-		using Gene = typename Crossover<GeneType>::Gene;
-		using Genotype = typename Crossover<GeneType>::Genotype;
+		using Gene = typename Crossover<GeneType, GenotypeType>::Gene;
+		using Genotype = typename Crossover<GeneType, GenotypeType>::Genotype;
+		using Changes = typename Crossover<GeneType, GenotypeType>::Changes;
 
 		void cross(Genotype& parentA, Genotype& parentB) override
 		{
 			
 		}
+
+		//	Genotypes stay unchanged, so change sets are left as they are
+		bool crossTracked(Genotype& parentA, Genotype& parentB, Changes& changesA, Changes& changesB) override
+		{
+			return false;
+		}
+	};
+
+	/**
+	 *	@brief	Single point crossover of packed boolean genes
+	 *
+	 *	@details Genes after crossover point are swapped whole words at once
+	 */
+	template <>
+	class SinglePointCrossover<bool, BitGenotype> : public Crossover<bool, BitGenotype>
+	{
+	public:
+		void cross(Genotype& parentA, Genotype& parentB) override
+		{
+			size_t crossover_point = getRandom().uniform(parentA.size());
+			parentA.swapRange(parentB, crossover_point, parentA.size());
+		}
+	};
+
+	/**
+	 *	@brief	Multiple point crossover of packed boolean genes
+	 *
+	 *	@details Sections between crossover points are swapped whole words at once
+	 */
+	template <>
+	class MultiplePointCrossover<bool, BitGenotype> : public Crossover<bool, BitGenotype>
+	{
+	public:
+		MultiplePointCrossover() = delete;
+		explicit MultiplePointCrossover(int number_of_points) : number_of_points_(number_of_points) { }
+		~MultiplePointCrossover() = default;
+
+		void cross(Genotype& parentA, Genotype& parentB) override
+		{
+			thread_local std::vector<size_t> crossover_points;
+			crossover_points.clear();
+
+			for (int i = 0; i < number_of_points_; ++i)
+				crossover_points.emplace_back(getRandom().uniform(parentA.size()));
+
+			std::sort(crossover_points.begin(), crossover_points.end());
+
+			for (int i = 0; i < number_of_points_ - 1; i += 2)
+				parentA.swapRange(parentB, crossover_points[i], crossover_points[i + 1]);
+		}
+
+	protected:
+		int number_of_points_;
+	};
+
+	/**
+	 *	@brief	Uniform crossover of packed boolean genes
+	 *
+	 *	@details Each word of genes is crossed with a random 64 bit mask, every
+	 *			 gene has 50% chance to be crossed
+	 */
+	template <>
+	class UniformCrossover<bool, BitGenotype> : public Crossover<bool, BitGenotype>
+	{
+	public:
+		void cross(Genotype& parentA, Genotype& parentB) override
+		{
+			Random& random = getRandom();
+			parentA.swapMasked(parentB, [&random]() { return random(); });
+		}
 	};
 
 }
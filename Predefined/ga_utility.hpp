@@ -1,6 +1,8 @@
 #ifndef __GA_UTILITY__
 #define __GA_UTILITY__
 
+#include <cstddef>
+
 namespace ga {
 
 	/**
@@ -36,6 +38,25 @@ namespace ga {
 		}
 	};
 
+
+	/**
+	 *	\brief	Number of genes that differ between two genotypes of equal size
+	 *
+	 *	\see	hammingDistance(const BitGenotype&, const BitGenotype&) for packed genes
+	 */
+	template <typename GenotypeType>
+	size_t hammingDistance(const GenotypeType& a, const GenotypeType& b)
+	{
+		size_t distance = 0;
+		for (size_t i = 0; i < a.size(); ++i)
+		{
+			if (!(a[i] == b[i]))
+				++distance;
+		}
+
+		return distance;
+	}
+
 }
 
 #endif // !__GA_UTILITY__
@@ -0,0 +1,440 @@
+/**
+ *  Set of predefined local search strategies for permutation
+ *  Genotypes representing tours (2-opt and Or-opt)
+ *
+ *  Authors: Michal Swiatek, Michal Sulek
+ *	Update:	 17.10.2026
+ *
+ *	Github repository: https://github.com/MichalKonradSulek/ZPR
+ */
+
+#ifndef __LOCAL_SEARCHES__
+#define __LOCAL_SEARCHES__
+
+#include <vector>
+#include <cstdint>
+#include <cstdlib>
+#include <algorithm>
+#include <initializer_list>
+
+#include "local_search.hpp"
+
+namespace ga {
+
+	/**
+	 *	@brief	Base class of local searches improving a tour
+	 *
+	 *	@details Genotype is an order of visited cities, a permutation of integers
+	 *			 0, 1, ..., size - 1. Moves are searched only among candidate
+	 *			 neighbours of a city and driven by don't-look bits: only cities
+	 *			 in a queue are examined, city is queued again when an edge
+	 *			 touching it changes. Search of tracked Genotype starts from cities
+	 *			 around genes changed since last evaluation
+	 *
+	 *	@tparam	Problem Type providing double distance(a, b) and neighboursBegin(a),
+	 *			neighboursEnd(a) - range of nearest cities sorted by distance
+	 *
+	 *	@note	Tour is closed (last city is connected with first one) by default,
+	 *			open path has no such edge
+	 */
+	template <typename GeneType, typename Problem, typename GenotypeType = std::vector<GeneType> >
+	class TourLocalSearch : public LocalSearch<GeneType, GenotypeType>
+	{
+	public:
+		using Gene = typename LocalSearch<GeneType, GenotypeType>::Gene;
+		using Genotype = typename LocalSearch<GeneType, GenotypeType>::Genotype;
+		using Changes = typename LocalSearch<GeneType, GenotypeType>::Changes;
+
+	protected:
+		//	Minimal gain accepted as an improvement
+		static constexpr double EPSILON = 1e-7;
+
+		const Problem&	problem_;
+		bool			closed_;
+
+		//	State of search of one tour, operator is shared by threads
+		struct Scratch
+		{
+			long long				size = 0;
+			Genotype*				tour = nullptr;
+			Changes*		changes = nullptr;
+
+			std::vector<long long>	position;
+			std::vector<uint8_t>	queued;
+			std::vector<Gene>		queue;
+			size_t					head = 0;
+			size_t					count = 0;
+		};
+
+		static Scratch& scratch()
+		{
+			//	Local search is called concurrently, every thread has its own buffers
+			thread_local Scratch scratch;
+			return scratch;
+		}
+
+		long long tourSize() const { return scratch().size; }
+
+		Genotype& tour() const { return *scratch().tour; }
+
+		Changes& changes() const { return *scratch().changes; }
+
+		long long next(long long position) const
+		{
+			long long size = tourSize();
+			return position + 1 < size ? position + 1 : (closed_ ? 0 : size);
+		}
+
+		long long previous(long long position) const
+		{
+			return position > 0 ? position - 1 : (closed_ ? tourSize() - 1 : -1);
+		}
+
+		bool isValid(long long position) const { return position >= 0 && position < tourSize(); }
+
+		Gene city(long long position) const { return tour()[position]; }
+
+		long long position(const Gene& city) const { return scratch().position[city]; }
+
+		//	Length of edge between positions, missing end of open path has no length
+		double edge(long long a, long long b) const
+		{
+			if (!isValid(a) || !isValid(b))
+				return 0.0;
+
+			return problem_.distance(city(a), city(b));
+		}
+
+		void activateCity(const Gene& gene)
+		{
+			activate(position(gene));
+		}
+
+		void activate(long long position)
+		{
+			if (!isValid(position))
+				return;
+
+			Scratch& s = scratch();
+			Gene gene = city(position);
+			if (s.queued[gene])
+				return;
+
+			s.queued[gene] = 1;
+			s.queue[(s.head + s.count++) % s.queue.size()] = gene;
+		}
+
+		void updatePositions(long long first, long long last)
+		{
+			Scratch& s = scratch();
+			for (long long i = first; i <= last; ++i)
+				s.position[(*s.tour)[i]] = i;
+		}
+
+		/**
+		 *	@brief	Reverses cities at positions [first, last]
+		 *
+		 *	@details In closed tour shorter of the two parts is reversed
+		 */
+		void reverse(long long first, long long last)
+		{
+			Genotype& tour = this->tour();
+			long long size = tourSize();
+			long long length = last - first + 1;
+
+			if (closed_ && 2 * length > size)
+			{
+				//	Reversing complement gives the same cycle in opposite direction
+				changes().record(tour, 0, first);
+				changes().record(tour, last + 1, size);
+
+				for (long long k = 0, inner = last + 1, outer = first - 1 + size; k < (size - length) / 2; ++k)
+				{
+					using std::swap;
+					swap(tour[(inner + k) % size], tour[(outer - k) % size]);
+				}
+
+				updatePositions(0, first - 1);
+				updatePositions(last + 1, size - 1);
+				return;
+			}
+
+			changes().record(tour, first, last + 1);
+			std::reverse(tour.begin() + first, tour.begin() + last + 1);
+			updatePositions(first, last);
+		}
+
+		/**
+		 *	@brief	Tries to find improving move starting from given city
+		 *
+		 *	@return	True if tour was modified
+		 */
+		virtual bool improveCity(Gene city) = 0;
+
+	public:
+		explicit TourLocalSearch(const Problem& problem, bool closed = true) : problem_(problem), closed_(closed) { }
+
+		bool improve(Genotype& genes) override
+		{
+			Changes untracked;
+			return improveTracked(genes, untracked);
+		}
+
+		bool improveTracked(Genotype& genes, Changes& changes) override
+		{
+			long long size = genes.size();
+			if (size < 4)
+				return false;
+
+			Scratch& s = scratch();
+			s.size = size;
+			s.tour = &genes;
+			s.changes = &changes;
+
+			s.position.resize(size);
+			s.queued.assign(size, 0);
+			s.queue.resize(size);
+			s.head = s.count = 0;
+
+			updatePositions(0, size - 1);
+
+			if (changes.isFull())
+			{
+				for (long long i = 0; i < size; ++i)
+					activate(i);
+			}
+			else
+			{
+				//	Only edges touching changed genes differ from already improved parent
+				for (const auto& range : changes.getMergedRanges())
+				{
+					activate(previous(range.first));
+					for (long long i = range.first; i < static_cast<long long>(range.last); ++i)
+						activate(i);
+					activate(range.last < genes.size() ? static_cast<long long>(range.last) : next(size - 1));
+				}
+			}
+
+			bool modified = false;
+			while (s.count > 0)
+			{
+				Gene gene = s.queue[s.head];
+				s.head = (s.head + 1) % s.queue.size();
+				--s.count;
+				s.queued[gene] = 0;
+
+				if (improveCity(gene))
+				{
+					modified = true;
+					activate(position(gene));
+				}
+			}
+
+			return modified;
+		}
+	};
+
+	/**
+	 *	@brief	2-opt local search
+	 *
+	 *	@details Replaces two edges of tour with two shorter ones by reversing
+	 *			 a part of tour. New edge always connects a city with one of its
+	 *			 candidate neighbours
+	 *
+	 *	@see	TourLocalSearch
+	 */
+	template <typename GeneType, typename Problem, typename GenotypeType = std::vector<GeneType> >
+	class TwoOptSearch : public TourLocalSearch<GeneType, Problem, GenotypeType>
+	{
+	public:
+		using Base = TourLocalSearch<GeneType, Problem, GenotypeType>;
+		using Gene = typename Base::Gene;
+
+		explicit TwoOptSearch(const Problem& problem, bool closed = true) : Base(problem, closed) { }
+
+	protected:
+		bool improveCity(Gene a) override
+		{
+			long long i = this->position(a);
+
+			for (int direction = 0; direction < 2; ++direction)
+			{
+				bool forward = direction == 0;
+
+				//	Edge (a, b) is removed and replaced with (a, c)
+				long long b = forward ? this->next(i) : this->previous(i);
+				if (!this->isValid(b))
+					continue;
+
+				double removed = this->edge(i, b);
+
+				for (auto it = this->problem_.neighboursBegin(a); it != this->problem_.neighboursEnd(a); ++it)
+				{
+					double gain = removed - this->problem_.distance(a, *it);
+					if (gain <= Base::EPSILON)
+						break;
+
+					//	Edge (c, d) is removed and replaced with (b, d)
+					long long c = this->position(*it);
+					long long d = forward ? this->next(c) : this->previous(c);
+					if (d == i || c == b)
+						continue;
+
+					gain += this->edge(c, d) - this->edge(b, d);
+					if (gain <= Base::EPSILON)
+						continue;
+
+					Gene city_b = this->city(b);
+					Gene city_d = this->isValid(d) ? this->city(d) : city_b;
+
+					if (forward)
+						i < c ? this->reverse(i + 1, c) : this->reverse(c + 1, i);
+					else
+						c < i ? this->reverse(c, i - 1) : this->reverse(i, c - 1);
+
+					//	Ends of both new edges
+					this->activateCity(a);
+					this->activateCity(*it);
+					this->activateCity(city_b);
+					this->activateCity(city_d);
+
+					return true;
+				}
+			}
+
+			return false;
+		}
+	};
+
+	/**
+	 *	@brief	Or-opt local search
+	 *
+	 *	@details Moves a segment of up to 3 cities starting with examined city
+	 *			 between two other adjacent cities, possibly reversed. Segment
+	 *			 is inserted next to a candidate neighbour of its end
+	 *
+	 *	@see	TourLocalSearch
+	 */
+	template <typename GeneType, typename Problem, typename GenotypeType = std::vector<GeneType> >
+	class OrOptSearch : public TourLocalSearch<GeneType, Problem, GenotypeType>
+	{
+	public:
+		using Base = TourLocalSearch<GeneType, Problem, GenotypeType>;
+		using Gene = typename Base::Gene;
+
+		static constexpr long long MAX_SEGMENT_LENGTH = 3;
+
+		explicit OrOptSearch(const Problem& problem, bool closed = true) : Base(problem, closed) { }
+
+	protected:
+		/**
+		 *	@brief	Moves segment [first, last] after position target, reversing it if requested
+		 */
+		void moveSegment(long long first, long long last, long long target, bool reversed)
+		{
+			auto& tour = this->tour();
+			long long length = last - first + 1;
+
+			long long begin, end;
+			if (target > last)
+			{
+				this->changes().record(tour, first, target + 1);
+				std::rotate(tour.begin() + first, tour.begin() + last + 1, tour.begin() + target + 1);
+
+				begin = target - length + 1;
+				this->updatePositions(first, target);
+			}
+			else
+			{
+				this->changes().record(tour, target + 1, last + 1);
+				std::rotate(tour.begin() + target + 1, tour.begin() + first, tour.begin() + last + 1);
+
+				begin = target + 1;
+				this->updatePositions(target + 1, last);
+			}
+
+			end = begin + length - 1;
+			if (reversed)
+			{
+				std::reverse(tour.begin() + begin, tour.begin() + end + 1);
+				this->updatePositions(begin, end);
+			}
+
+			this->activate(this->previous(begin));
+			this->activate(begin);
+			this->activate(end);
+			this->activate(this->next(end));
+		}
+
+		bool improveCity(Gene a) override
+		{
+			long long first = this->position(a);
+			long long size = this->tourSize();
+
+			for (long long last = first; last < first + MAX_SEGMENT_LENGTH && last < size; ++last)
+			{
+				if (last - first + 4 > size)
+					break;
+
+				long long before = this->previous(first);
+				long long after = this->next(last);
+
+				//	Gain of removing segment and connecting its neighbours
+				double removed = this->edge(before, first) + this->edge(last, after) - this->edge(before, after);
+				if (removed <= Base::EPSILON)
+					continue;
+
+				for (long long end : { first, last })
+				{
+					Gene x = this->city(end);
+					long long other_end = end == first ? last : first;
+
+					for (auto it = this->problem_.neighboursBegin(x); it != this->problem_.neighboursEnd(x); ++it)
+					{
+						double added = this->problem_.distance(x, *it);
+						if (added >= removed - Base::EPSILON)
+							break;
+
+						long long c = this->position(*it);
+						if (c >= first && c <= last)
+							continue;
+
+						//	Segment goes between c and its successor or its predecessor
+						for (int side = 0; side < 2; ++side)
+						{
+							bool insert_after = side == 0;
+
+							long long k = insert_after ? this->next(c) : this->previous(c);
+							if (k >= first && k <= last)
+								continue;
+
+							double gain = removed - added - this->edge(other_end, k) + this->edge(c, k);
+							if (gain <= Base::EPSILON)
+								continue;
+
+							//	Cities around removed segment become adjacent
+							bool has_before = this->isValid(before), has_after = this->isValid(after);
+							Gene city_before = has_before ? this->city(before) : x;
+							Gene city_after = has_after ? this->city(after) : x;
+
+							bool reversed = insert_after ? end == last : end == first;
+							moveSegment(first, last, insert_after ? c : c - 1, reversed);
+
+							if (has_before)
+								this->activateCity(city_before);
+							if (has_after)
+								this->activateCity(city_after);
+
+							return true;
+						}
+					}
+				}
+			}
+
+			return false;
+		}
+	};
+
+}
+
+#endif // !__LOCAL_SEARCHES__
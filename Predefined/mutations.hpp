@@ -11,6 +11,8 @@
 #define __MUTATIONS__
 
 #include "mutation.hpp"
+#include "random.hpp"
+#include "bit_genotype.hpp"
 
 #include <cstdlib>
 #include <algorithm>
@@ -28,6 +30,7 @@ namespace ga {
 	public:
 		using Gene = typename Mutation<bool>::Gene;
 		using Genotype = typename Mutation<bool>::Genotype;
+		using Changes = typename Mutation<bool>::Changes;
 
 	public:
 		explicit FlipBitMutation(int mutation_chance = MUTATION_CHANCE_PERCENT, int mutation_iterations = 1, int max_mutations = 1) : MultipleMutation<bool>(mutation_chance, mutation_iterations, max_mutations) { }
@@ -35,37 +38,133 @@ namespace ga {
 
 		void performMutation(Genotype& genes) const override
 		{
-			int choice = rand() % genes.size();
+			Changes untracked;
+			performTrackedMutation(genes, untracked);
+		}
+
+		void performTrackedMutation(Genotype& genes, Changes& changes) const override
+		{
+			size_t choice = getRandom().uniform(genes.size());
 
+			changes.record(genes, choice);
 			genes[choice] = !genes[choice];
 		}
 	};
 
+	/**
+	 *	@brief	Mutation strategy flipping bits of packed boolean genes
+	 *
+	 *	@details Equivalent of FlipBitMutation for BitGenotype, N bits are
+	 *			 randomly picked and for each of them there is chance to be
+	 *			 flipped equivalent to mutation_chance
+	 */
+	class PackedFlipBitMutation : public MultipleMutation<bool, BitGenotype>
+	{
+	public:
+		using Gene = typename Mutation<bool, BitGenotype>::Gene;
+		using Genotype = typename Mutation<bool, BitGenotype>::Genotype;
+		using Changes = typename Mutation<bool, BitGenotype>::Changes;
+
+	public:
+		explicit PackedFlipBitMutation(int mutation_chance = MUTATION_CHANCE_PERCENT, int mutation_iterations = 1, int max_mutations = 1) : MultipleMutation<bool, BitGenotype>(mutation_chance, mutation_iterations, max_mutations) { }
+		~PackedFlipBitMutation() override = default;
+
+		void performMutation(Genotype& genes) const override
+		{
+			genes.flip(getRandom().uniform(genes.size()));
+		}
+
+		void performTrackedMutation(Genotype& genes, Changes& changes) const override
+		{
+			size_t choice = getRandom().uniform(genes.size());
+
+			changes.record(genes, choice);
+			genes.flip(choice);
+		}
+	};
+
+	/**
+	 *	@brief	Mutation strategy flipping every bit with given propability
+	 *
+	 *	@details Positions of flipped bits are sampled with geometric skips,
+	 *			 so cost depends on number of flipped bits only
+	 *
+	 *	@see	PerGeneMutation
+	 */
+	class PerGeneFlipBitMutation : public PerGeneMutation<bool>
+	{
+	public:
+		explicit PerGeneFlipBitMutation(double gene_mutation_rate = 0.01, int mutation_chance = MAX_MUTATION_CHANCE) : PerGeneMutation<bool>(gene_mutation_rate, mutation_chance) { }
+
+	protected:
+		void mutateGene(Genotype& genes, size_t position) const override
+		{
+			genes[position] = !genes[position];
+		}
+	};
+
+	/**
+	 *	@brief	Mutation strategy flipping every packed bit with given propability
+	 *
+	 *	@details Equivalent of PerGeneFlipBitMutation for BitGenotype
+	 *
+	 *	@see	PerGeneMutation
+	 */
+	class PackedPerGeneFlipBitMutation : public PerGeneMutation<bool, BitGenotype>
+	{
+	public:
+		explicit PackedPerGeneFlipBitMutation(double gene_mutation_rate = 0.01, int mutation_chance = MAX_MUTATION_CHANCE) : PerGeneMutation<bool, BitGenotype>(gene_mutation_rate, mutation_chance) { }
+
+	protected:
+		void mutateGene(Genotype& genes, size_t position) const override
+		{
+			genes.flip(position);
+		}
+	};
+
 	/**
 	 *	@brief	Mutation strategy that swaps pairs of Genes
 	 *
 	 *	@details N pairs of genes are picked and for each of them there is
 	 *			 a swap chance equivalent to mutation_chance
 	 */
-	template <typename GeneType>
-	class SwapGeneMutation : public MultipleMutation<GeneType>
+	template <typename GeneType, typename GenotypeType = std::vector<GeneType> >
+	class SwapGeneMutation : public MultipleMutation<GeneType, GenotypeType>
 	{
 	public:
-		using Gene = typename Mutation<GeneType>::Gene;
-		using Genotype = typename Mutation<GeneType>::Genotype;
+		using Gene = typename Mutation<GeneType, GenotypeType>::Gene;
+		using Genotype = typename Mutation<GeneType, GenotypeType>::Genotype;
+		using Changes = typename Mutation<GeneType, GenotypeType>::Changes;
 
-		explicit SwapGeneMutation(int swap_range = -1, int mutation_chance = MUTATION_CHANCE_PERCENT, int mutation_iterations = 1, int max_mutations = 10) : MultipleMutation<GeneType>(mutation_chance, mutation_iterations, max_mutations), swap_range_(swap_range) { }
+		explicit SwapGeneMutation(int swap_range = -1, int mutation_chance = MUTATION_CHANCE_PERCENT, int mutation_iterations = 1, int max_mutations = 10) : MultipleMutation<GeneType, GenotypeType>(mutation_chance, mutation_iterations, max_mutations), swap_range_(swap_range) { }
 		~SwapGeneMutation() = default;
 
 		void performMutation(Genotype& genes) const override
 		{
-			size_t a = rand() % genes.size();
-			size_t b = rand() % genes.size();
+			Changes untracked;
+			performTrackedMutation(genes, untracked);
+		}
+
+		void performTrackedMutation(Genotype& genes, Changes& changes) const override
+		{
+			Random& random = getRandom();
+
+			size_t a = random.uniform(genes.size());
+			size_t b = random.uniform(genes.size());
 			if (swap_range_ != -1)
+			{
 				//	Wrap around if index out of bound
-				b = (a + (rand() % (2 * swap_range_) - swap_range_)) % genes.size();
+				long long size = genes.size();
+				long long shift = (long long)random.uniform(2 * swap_range_) - swap_range_;
+				b = ((a + shift) % size + size) % size;
+			}
 
-			std::swap(genes[a], genes[b]);
+			changes.record(genes, a);
+			changes.record(genes, b);
+
+			//	Unqualified call allows proxy references (e.g. std::vector<bool>) to be swapped
+			using std::swap;
+			swap(genes[a], genes[b]);
 		}
 
 	protected:
@@ -79,25 +178,33 @@ namespace ga {
 	 *	@details A point and a range of mutation are randomly picked, then
 	 *			 genes in range <point, scramble_range) are shuffled
 	 */
-	template <typename GeneType>
-	class ScrambleGenesMutation : public Mutation<GeneType>
+	template <typename GeneType, typename GenotypeType = std::vector<GeneType> >
+	class ScrambleGenesMutation : public Mutation<GeneType, GenotypeType>
 	{
 	public:
-		using Gene = typename Mutation<GeneType>::Gene;
-		using Genotype = typename Mutation<GeneType>::Genotype;
+		using Gene = typename Mutation<GeneType, GenotypeType>::Gene;
+		using Genotype = typename Mutation<GeneType, GenotypeType>::Genotype;
+		using Changes = typename Mutation<GeneType, GenotypeType>::Changes;
 
-		explicit ScrambleGenesMutation(int scramble_range = -1, int mutation_chance = MUTATION_CHANCE_PERCENT) : Mutation<GeneType>(mutation_chance), scramble_range_(scramble_range) { }
+		explicit ScrambleGenesMutation(int scramble_range = -1, int mutation_chance = MUTATION_CHANCE_PERCENT) : Mutation<GeneType, GenotypeType>(mutation_chance), scramble_range_(scramble_range) { }
 		~ScrambleGenesMutation() = default;
 
 		void performMutation(Genotype& genes) const override
 		{
-			size_t a = rand() % genes.size();
-			size_t range = scramble_range_ == -1 ? rand() % genes.size() : rand() % scramble_range_ + 1;
-			
-			if (a + range >= genes.size())
-				std::random_shuffle(genes.begin() + a, genes.end());
-			else
-				std::random_shuffle(genes.begin() + a, genes.begin() + a + range);
+			Changes untracked;
+			performTrackedMutation(genes, untracked);
+		}
+
+		void performTrackedMutation(Genotype& genes, Changes& changes) const override
+		{
+			Random& random = getRandom();
+
+			size_t a = random.uniform(genes.size());
+			size_t range = scramble_range_ == -1 ? random.uniform(genes.size()) : random.uniform(scramble_range_) + 1;
+			size_t last = std::min(a + range, genes.size());
+
+			changes.record(genes, a, last);
+			std::shuffle(genes.begin() + a, genes.begin() + last, random);
 		}
 
 	protected:
@@ -110,25 +217,33 @@ namespace ga {
 	 *	@details A point and a range of mutation are randomly picked, then
 	 *			 genes in range <point, scramble_range) are inverted
 	 */
-	template <typename GeneType>
-	class InverseGenesMutation : public Mutation<GeneType>
+	template <typename GeneType, typename GenotypeType = std::vector<GeneType> >
+	class InverseGenesMutation : public Mutation<GeneType, GenotypeType>
 	{
 	public:
-		using Gene = typename Mutation<GeneType>::Gene;
-		using Genotype = typename Mutation<GeneType>::Genotype;
+		using Gene = typename Mutation<GeneType, GenotypeType>::Gene;
+		using Genotype = typename Mutation<GeneType, GenotypeType>::Genotype;
+		using Changes = typename Mutation<GeneType, GenotypeType>::Changes;
 
-		explicit InverseGenesMutation(int inverse_range, int mutation_chance = MUTATION_CHANCE_PERCENT) : Mutation<GeneType>(mutation_chance), inverse_range_(inverse_range) { }
+		explicit InverseGenesMutation(int inverse_range, int mutation_chance = MUTATION_CHANCE_PERCENT) : Mutation<GeneType, GenotypeType>(mutation_chance), inverse_range_(inverse_range) { }
 		~InverseGenesMutation() = default;
 
 		void performMutation(Genotype& genes) const override
 		{
-			size_t a = rand() % genes.size();
-			size_t range = inverse_range_ == -1 ? rand() % genes.size() : rand() % inverse_range_ + 1;
+			Changes untracked;
+			performTrackedMutation(genes, untracked);
+		}
+
+		void performTrackedMutation(Genotype& genes, Changes& changes) const override
+		{
+			Random& random = getRandom();
+
+			size_t a = random.uniform(genes.size());
+			size_t range = inverse_range_ == -1 ? random.uniform(genes.size()) : random.uniform(inverse_range_) + 1;
+			size_t last = std::min(a + range, genes.size());
 
-			if (a + range >= genes.size())
-				std::reverse(genes.begin() + a, genes.end());
-			else
-				std::reverse(genes.begin() + a, genes.begin() + a + range);
+			changes.record(genes, a, last);
+			std::reverse(genes.begin() + a, genes.begin() + last);
 		}
 
 	protected:
@@ -0,0 +1,442 @@
+/**
+ *  Set of predefined crossover strategies preserving permutations,
+ *  used when Genotype is an ordering of elements (e.g. a tour of
+ *  traveling salesman)
+ *
+ *  Authors: Michal Swiatek, Michal Sulek
+ *	Update:	 17.10.2026
+ *
+ *	Github repository: https://github.com/MichalKonradSulek/ZPR
+ */
+
+#ifndef __PERMUTATION_CROSSOVERS__
+#define __PERMUTATION_CROSSOVERS__
+
+#include <vector>
+#include <cstdint>
+#include <cstdlib>
+#include <algorithm>
+#include <initializer_list>
+
+#include "crossover.hpp"
+#include "random.hpp"
+
+namespace ga {
+
+	namespace detail {
+
+		/**
+		 *	@brief	Copies child over parent recording smallest range of changed genes
+		 */
+		template <typename Genotype, typename Gene, typename Changes>
+		void replaceTracked(Genotype& parent, const std::vector<Gene>& child, Changes& changes)
+		{
+			size_t first = 0;
+			while (first < parent.size() && parent[first] == child[first])
+				++first;
+
+			size_t last = parent.size();
+			while (last > first && parent[last - 1] == child[last - 1])
+				--last;
+
+			changes.record(parent, first, last);
+			std::copy(child.begin() + first, child.begin() + last, parent.begin() + first);
+		}
+
+		/**
+		 *	@brief	Random segment [first, last) of genome of given size
+		 */
+		inline void randomSegment(size_t size, size_t& first, size_t& last)
+		{
+			first = getRandom().uniform(size);
+			last = getRandom().uniform(size);
+
+			if (first > last)
+				std::swap(first, last);
+			++last;
+		}
+
+	}
+
+	/**
+	 *	@brief	Order crossover (OX)
+	 *
+	 *	@details Child keeps random segment of one parent, remaining positions
+	 *			 (starting after the segment) are filled with missing genes in
+	 *			 order they appear in the other parent
+	 *
+	 *	@note	Genotype has to be a permutation of integers 0, 1, ..., size - 1,
+	 *			genes are used as indices of lookup tables
+	 */
+	template <typename GeneType, typename GenotypeType = std::vector<GeneType> >
+	class OrderCrossover : public Crossover<GeneType, GenotypeType>
+	{
+	public:
+		using Gene = typename Crossover<GeneType, GenotypeType>::Gene;
+		using Genotype = typename Crossover<GeneType, GenotypeType>::Genotype;
+		using Changes = typename Crossover<GeneType, GenotypeType>::Changes;
+
+	private:
+		static void makeChild(const Genotype& kept, const Genotype& other, size_t first, size_t last,
+							  std::vector<uint8_t>& used, std::vector<Gene>& child)
+		{
+			size_t size = kept.size();
+
+			std::fill(used.begin(), used.end(), 0);
+			for (size_t i = first; i < last; ++i)
+			{
+				child[i] = kept[i];
+				used[kept[i]] = 1;
+			}
+
+			//	Genes of other parent are read from last to the end and then from the beginning
+			size_t position = last == size ? 0 : last;
+			auto place = [&](const Gene& gene)
+			{
+				if (used[gene])
+					return;
+
+				child[position] = gene;
+				if (++position == size)
+					position = 0;
+			};
+
+			for (size_t i = last; i < size; ++i)
+				place(other[i]);
+			for (size_t i = 0; i < last; ++i)
+				place(other[i]);
+		}
+
+	public:
+		void cross(Genotype& parentA, Genotype& parentB) override
+		{
+			Changes untracked;
+			crossTracked(parentA, parentB, untracked, untracked);
+		}
+
+		bool crossTracked(Genotype& parentA, Genotype& parentB, Changes& changesA, Changes& changesB) override
+		{
+			if (parentA.size() < 2)
+				return false;
+
+			//	Reused between calls, so crossing doesn't allocate after first call on a thread
+			thread_local std::vector<uint8_t> used;
+			thread_local std::vector<Gene> childA, childB;
+			used.resize(parentA.size());
+			childA.resize(parentA.size());
+			childB.resize(parentA.size());
+
+			size_t first, last;
+			detail::randomSegment(parentA.size(), first, last);
+
+			makeChild(parentA, parentB, first, last, used, childA);
+			makeChild(parentB, parentA, first, last, used, childB);
+
+			detail::replaceTracked(parentA, childA, changesA);
+			detail::replaceTracked(parentB, childB, changesB);
+
+			return true;
+		}
+	};
+
+	/**
+	 *	@brief	Partially mapped crossover (PMX)
+	 *
+	 *	@details Random segments of parents are exchanged, genes duplicated outside
+	 *			 of the segment are replaced according to mapping defined by the
+	 *			 segments. Implemented with swaps guided by position lookup table
+	 *
+	 *	@note	Genotype has to be a permutation of integers 0, 1, ..., size - 1
+	 */
+	template <typename GeneType, typename GenotypeType = std::vector<GeneType> >
+	class PartiallyMappedCrossover : public Crossover<GeneType, GenotypeType>
+	{
+	public:
+		using Gene = typename Crossover<GeneType, GenotypeType>::Gene;
+		using Genotype = typename Crossover<GeneType, GenotypeType>::Genotype;
+		using Changes = typename Crossover<GeneType, GenotypeType>::Changes;
+
+	private:
+		//	Places given segment in child, position[g] is index of gene g in child
+		static void applySegment(Genotype& child, const std::vector<Gene>& segment, size_t first,
+								 std::vector<size_t>& position, Changes& changes)
+		{
+			for (size_t i = 0; i < child.size(); ++i)
+				position[child[i]] = i;
+
+			for (size_t i = 0; i < segment.size(); ++i)
+			{
+				size_t target = first + i;
+				size_t source = position[segment[i]];
+				if (source == target)
+					continue;
+
+				changes.record(child, target);
+				changes.record(child, source);
+
+				position[child[target]] = source;
+				position[segment[i]] = target;
+
+				using std::swap;
+				swap(child[target], child[source]);
+			}
+		}
+
+	public:
+		void cross(Genotype& parentA, Genotype& parentB) override
+		{
+			Changes untracked;
+			crossTracked(parentA, parentB, untracked, untracked);
+		}
+
+		bool crossTracked(Genotype& parentA, Genotype& parentB, Changes& changesA, Changes& changesB) override
+		{
+			if (parentA.size() < 2)
+				return false;
+
+			thread_local std::vector<size_t> position;
+			thread_local std::vector<Gene> segmentA, segmentB;
+			position.resize(parentA.size());
+
+			size_t first, last;
+			detail::randomSegment(parentA.size(), first, last);
+
+			segmentA.assign(parentA.begin() + first, parentA.begin() + last);
+			segmentB.assign(parentB.begin() + first, parentB.begin() + last);
+
+			applySegment(parentA, segmentB, first, position, changesA);
+			applySegment(parentB, segmentA, first, position, changesB);
+
+			return true;
+		}
+	};
+
+	/**
+	 *	@brief	Cycle crossover (CX)
+	 *
+	 *	@details Positions are divided into cycles of genes shared by parents,
+	 *			 genes of every second cycle are exchanged, so every gene keeps
+	 *			 position it had in one of parents
+	 *
+	 *	@note	Genotype has to be a permutation of integers 0, 1, ..., size - 1
+	 */
+	template <typename GeneType, typename GenotypeType = std::vector<GeneType> >
+	class CycleCrossover : public Crossover<GeneType, GenotypeType>
+	{
+	public:
+		using Gene = typename Crossover<GeneType, GenotypeType>::Gene;
+		using Genotype = typename Crossover<GeneType, GenotypeType>::Genotype;
+		using Changes = typename Crossover<GeneType, GenotypeType>::Changes;
+
+		void cross(Genotype& parentA, Genotype& parentB) override
+		{
+			Changes untracked;
+			crossTracked(parentA, parentB, untracked, untracked);
+		}
+
+		bool crossTracked(Genotype& parentA, Genotype& parentB, Changes& changesA, Changes& changesB) override
+		{
+			thread_local std::vector<size_t> positionA;
+			thread_local std::vector<uint8_t> visited;
+			positionA.resize(parentA.size());
+			visited.assign(parentA.size(), 0);
+
+			for (size_t i = 0; i < parentA.size(); ++i)
+				positionA[parentA[i]] = i;
+
+			bool modified = false;
+			bool exchange = false;
+			for (size_t start = 0; start < parentA.size(); ++start)
+			{
+				if (visited[start])
+					continue;
+
+				//	Genes of a cycle occupy the same positions in both parents
+				for (size_t i = start, next; !visited[i]; i = next)
+				{
+					visited[i] = 1;
+					next = positionA[parentB[i]];
+
+					if (exchange && parentA[i] != parentB[i])
+					{
+						changesA.record(parentA, i);
+						changesB.record(parentB, i);
+
+						using std::swap;
+						swap(parentA[i], parentB[i]);
+						modified = true;
+					}
+				}
+
+				exchange = !exchange;
+			}
+
+			return modified;
+		}
+	};
+
+	/**
+	 *	@brief	Edge recombination crossover (ERX)
+	 *
+	 *	@details Child is built from edges present in any parent (Genotype is
+	 *			 treated as a cycle). Next gene is the neighbour of current one with
+	 *			 fewest remaining neighbours, random unused gene is taken when
+	 *			 current gene has none. Every child is built independently, first
+	 *			 one starts with first gene of parentA, second with first gene of parentB
+	 *
+	 *	@note	Genotype has to be a permutation of integers 0, 1, ..., size - 1
+	 */
+	template <typename GeneType, typename GenotypeType = std::vector<GeneType> >
+	class EdgeRecombinationCrossover : public Crossover<GeneType, GenotypeType>
+	{
+	public:
+		using Gene = typename Crossover<GeneType, GenotypeType>::Gene;
+		using Genotype = typename Crossover<GeneType, GenotypeType>::Genotype;
+		using Changes = typename Crossover<GeneType, GenotypeType>::Changes;
+
+	private:
+		//	Every gene has at most 4 distinct neighbours in two parents
+		static constexpr size_t MAX_EDGES = 4;
+
+		struct Scratch
+		{
+			std::vector<Gene>		edges;
+			std::vector<uint8_t>	degree;
+			std::vector<uint8_t>	used;
+			std::vector<Gene>		unused;
+			std::vector<size_t>		unused_position;
+			std::vector<Gene>		child;
+		};
+
+		static void addEdge(Scratch& scratch, const Gene& from, const Gene& to)
+		{
+			Gene* edges = &scratch.edges[from * MAX_EDGES];
+			uint8_t& degree = scratch.degree[from];
+
+			if (std::find(edges, edges + degree, to) == edges + degree)
+				edges[degree++] = to;
+		}
+
+		static void removeEdge(Scratch& scratch, const Gene& from, const Gene& to)
+		{
+			Gene* edges = &scratch.edges[from * MAX_EDGES];
+			uint8_t& degree = scratch.degree[from];
+
+			Gene* it = std::find(edges, edges + degree, to);
+			if (it != edges + degree)
+				*it = edges[--degree];
+		}
+
+		static void buildEdges(Scratch& scratch, const Genotype& parentA, const Genotype& parentB)
+		{
+			size_t size = parentA.size();
+
+			scratch.edges.resize(size * MAX_EDGES);
+			scratch.degree.assign(size, 0);
+
+			for (const Genotype* parent : { &parentA, &parentB })
+			{
+				for (size_t i = 0; i < size; ++i)
+				{
+					const Gene& gene = (*parent)[i];
+					addEdge(scratch, gene, (*parent)[(i + 1) % size]);
+					addEdge(scratch, gene, (*parent)[(i + size - 1) % size]);
+				}
+			}
+		}
+
+		static void makeChild(Scratch& scratch, const Gene& start)
+		{
+			size_t size = scratch.degree.size();
+			Random& random = getRandom();
+
+			scratch.used.assign(size, 0);
+			scratch.unused.resize(size);
+			scratch.unused_position.resize(size);
+			for (size_t i = 0; i < size; ++i)
+			{
+				scratch.unused[i] = static_cast<Gene>(i);
+				scratch.unused_position[i] = i;
+			}
+			size_t unused_count = size;
+
+			Gene current = start;
+			for (size_t i = 0; i < size; ++i)
+			{
+				scratch.child[i] = current;
+				scratch.used[current] = 1;
+
+				//	Constant time removal from list of unused genes
+				size_t position = scratch.unused_position[current];
+				Gene moved = scratch.unused[--unused_count];
+				scratch.unused[position] = moved;
+				scratch.unused_position[moved] = position;
+
+				const Gene* edges = &scratch.edges[current * MAX_EDGES];
+				uint8_t degree = scratch.degree[current];
+				for (uint8_t e = 0; e < degree; ++e)
+					removeEdge(scratch, edges[e], current);
+
+				if (unused_count == 0)
+					break;
+
+				if (degree == 0)
+				{
+					current = scratch.unused[random.uniform(unused_count)];
+					continue;
+				}
+
+				//	Neighbour with fewest remaining edges, ties are broken randomly
+				Gene next = edges[0];
+				size_t ties = 1;
+				for (uint8_t e = 1; e < degree; ++e)
+				{
+					if (scratch.degree[edges[e]] < scratch.degree[next])
+					{
+						next = edges[e];
+						ties = 1;
+					}
+					else if (scratch.degree[edges[e]] == scratch.degree[next] && random.uniform(++ties) == 0)
+						next = edges[e];
+				}
+
+				current = next;
+			}
+		}
+
+	public:
+		void cross(Genotype& parentA, Genotype& parentB) override
+		{
+			Changes untracked;
+			crossTracked(parentA, parentB, untracked, untracked);
+		}
+
+		bool crossTracked(Genotype& parentA, Genotype& parentB, Changes& changesA, Changes& changesB) override
+		{
+			if (parentA.size() < 2)
+				return false;
+
+			thread_local Scratch scratch;
+			thread_local std::vector<Gene> childA;
+
+			scratch.child.resize(parentA.size());
+
+			buildEdges(scratch, parentA, parentB);
+			makeChild(scratch, parentA[0]);
+			childA.swap(scratch.child);
+
+			scratch.child.resize(parentA.size());
+
+			buildEdges(scratch, parentA, parentB);
+			makeChild(scratch, parentB[0]);
+
+			detail::replaceTracked(parentA, childA, changesA);
+			detail::replaceTracked(parentB, scratch.child, changesB);
+
+			return true;
+		}
+	};
+
+}
+
+#endif // !__PERMUTATION_CROSSOVERS__
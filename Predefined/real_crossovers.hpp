@@ -0,0 +1,180 @@
+/*
+ *  Set of predefined crossover strategies for real-coded genetic algorithms,
+ *	Genotypes are sequences of double Genes (std::vector, std::array or GeneRow)
+ *
+ *  Authors: Michal Swiatek, Michal Sulek
+ *	Update:	 17.10.2026
+ *
+ *	Github repository: https://github.com/MichalKonradSulek/ZPR
+ */
+
+#ifndef __REAL_CROSSOVERS__
+#define __REAL_CROSSOVERS__
+
+#include <vector>
+#include <limits>
+#include <cmath>
+#include <algorithm>
+#include <type_traits>
+
+#include "crossover.hpp"
+#include "random.hpp"
+#include "real_kernels.hpp"
+
+namespace ga {
+
+	/**
+	 *	@brief	Base class of crossovers of real-valued Genes
+	 *
+	 *	@details Offspring Genes are clamped to [lower, upper], both parents
+	 *			 are modified as a whole, so change sets record whole Genotypes
+	 *
+	 *	@note	override crossGenes(Gene* parentA, Gene* parentB, size_t size)
+	 */
+	template <typename GeneType, typename GenotypeType = std::vector<GeneType> >
+	class RealCrossover : public Crossover<GeneType, GenotypeType>
+	{
+		static_assert(std::is_same<GeneType, double>::value, "Real-coded crossovers operate on double Genes");
+
+	public:
+		using Gene = typename Crossover<GeneType, GenotypeType>::Gene;
+		using Genotype = typename Crossover<GeneType, GenotypeType>::Genotype;
+		using Changes = typename Crossover<GeneType, GenotypeType>::Changes;
+
+	protected:
+		double lower_;
+		double upper_;
+
+		virtual void crossGenes(Gene* parentA, Gene* parentB, size_t size) = 0;
+
+	public:
+		explicit RealCrossover(double lower = -std::numeric_limits<double>::infinity(),
+							   double upper = std::numeric_limits<double>::infinity()) : lower_(lower), upper_(upper) { }
+
+		void cross(Genotype& parentA, Genotype& parentB) override
+		{
+			crossGenes(parentA.data(), parentB.data(), std::min(parentA.size(), parentB.size()));
+		}
+
+		bool crossTracked(Genotype& parentA, Genotype& parentB, Changes& changesA, Changes& changesB) override
+		{
+			size_t size = std::min(parentA.size(), parentB.size());
+
+			changesA.record(parentA, 0, size);
+			changesB.record(parentB, 0, size);
+
+			crossGenes(parentA.data(), parentB.data(), size);
+
+			return size > 0;
+		}
+
+		double getLowerBound() const { return lower_; }
+		double getUpperBound() const { return upper_; }
+	};
+
+	/**
+	 *	@brief	Whole arithmetic crossover
+	 *
+	 *	@details Children are weighted averages of parents: w * A + (1 - w) * B
+	 *			 and (1 - w) * A + w * B. With negative weight (default) w is
+	 *			 drawn uniformly from [0, 1) for every crossover
+	 */
+	template <typename GeneType, typename GenotypeType = std::vector<GeneType> >
+	class ArithmeticCrossover : public RealCrossover<GeneType, GenotypeType>
+	{
+	public:
+		using Gene = typename RealCrossover<GeneType, GenotypeType>::Gene;
+
+	private:
+		double weight_;
+
+	protected:
+		void crossGenes(Gene* parentA, Gene* parentB, size_t size) override
+		{
+			double weight = weight_ < 0.0 ? getRandom().uniformReal() : weight_;
+			detail::blendKernel(parentA, parentB, size, weight);
+		}
+
+	public:
+		explicit ArithmeticCrossover(double weight = -1.0) : weight_(weight) { }
+	};
+
+	/**
+	 *	@brief	Blend crossover (BLX-alpha)
+	 *
+	 *	@details Every Gene of each child is drawn uniformly from interval spanned
+	 *			 by Genes of parents, extended by alpha times its length on both
+	 *			 sides. Random numbers for all Genes are generated in one pass
+	 */
+	template <typename GeneType, typename GenotypeType = std::vector<GeneType> >
+	class BlendCrossover : public RealCrossover<GeneType, GenotypeType>
+	{
+	public:
+		using Gene = typename RealCrossover<GeneType, GenotypeType>::Gene;
+
+	private:
+		double alpha_;
+
+	protected:
+		void crossGenes(Gene* parentA, Gene* parentB, size_t size) override
+		{
+			//	Reused between calls, so crossing doesn't allocate after first call on a thread
+			thread_local std::vector<double> uniform;
+			uniform.resize(2 * size);
+
+			detail::RandomLanes lanes(getRandom());
+			lanes.fillUniform(uniform.data(), uniform.size());
+
+			detail::blendAlphaKernel(parentA, parentB, uniform.data(), uniform.data() + size, size,
+									 alpha_, 1.0 + 2.0 * alpha_, this->lower_, this->upper_);
+		}
+
+	public:
+		explicit BlendCrossover(double alpha = 0.5,
+								double lower = -std::numeric_limits<double>::infinity(),
+								double upper = std::numeric_limits<double>::infinity())
+			: RealCrossover<GeneType, GenotypeType>(lower, upper), alpha_(alpha) { }
+	};
+
+	/**
+	 *	@brief	Simulated binary crossover (SBX)
+	 *
+	 *	@details Children are placed symmetrically around mean of parents, spread
+	 *			 factor of every Gene is drawn from polynomial distribution with
+	 *			 given distribution index. Large index keeps children close to
+	 *			 parents
+	 */
+	template <typename GeneType, typename GenotypeType = std::vector<GeneType> >
+	class SimulatedBinaryCrossover : public RealCrossover<GeneType, GenotypeType>
+	{
+	public:
+		using Gene = typename RealCrossover<GeneType, GenotypeType>::Gene;
+
+	private:
+		double exponent_;
+
+	protected:
+		void crossGenes(Gene* parentA, Gene* parentB, size_t size) override
+		{
+			thread_local std::vector<double> beta;
+			beta.resize(size);
+
+			detail::RandomLanes lanes(getRandom());
+			lanes.fillUniform(beta.data(), size);
+
+			for (auto& value : beta)
+				value = value <= 0.5 ? std::pow(2.0 * value, exponent_) : std::pow(0.5 / (1.0 - value), exponent_);
+
+			detail::spreadKernel(parentA, parentB, beta.data(), size, this->lower_, this->upper_);
+		}
+
+	public:
+		explicit SimulatedBinaryCrossover(double distribution_index = 15.0,
+										  double lower = -std::numeric_limits<double>::infinity(),
+										  double upper = std::numeric_limits<double>::infinity())
+			: RealCrossover<GeneType, GenotypeType>(lower, upper), exponent_(1.0 / (distribution_index + 1.0)) { }
+	};
+
+}
+
+#endif // !__REAL_CROSSOVERS__
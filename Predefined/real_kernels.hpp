@@ -0,0 +1,351 @@
+/**
+ *	Kernels of real-coded genetic operators working on arrays of double
+ *	genes. With AVX2 enabled at compile time (e.g. GA_ENABLE_AVX2 option
+ *	of cmake) four genes are processed at once, otherwise scalar loops
+ *	are used. Vector kernels don't use fused multiply-add, so they give
+ *	the same results as scalar loops compiled without FMA contraction
+ *
+ *	Authors: Michal Swiatek, Michal Sulek
+ *	Update:	 17.10.2026
+ *
+ *	Github repository: https://github.com/MichalKonradSulek/ZPR
+ */
+
+#ifndef __REAL_KERNELS__
+#define __REAL_KERNELS__
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <cstddef>
+#include <algorithm>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+#include "random.hpp"
+
+namespace ga {
+
+	namespace detail {
+
+		/**
+		 *	@brief	Four interleaved xoshiro256** generators filling arrays of doubles
+		 *
+		 *	@details Lanes are seeded with consecutive splitmix64 outputs of one seed,
+		 *			 so a generator is created from a single draw of getRandom(). Every
+		 *			 step produces one number per lane, with AVX2 all lanes advance in
+		 *			 one set of instructions. Sequence doesn't depend on AVX2
+		 */
+		class RandomLanes
+		{
+		public:
+			static const size_t LANES = 4;
+
+		private:
+			//	state_[word][lane]
+			alignas(32) uint64_t state_[4][LANES];
+
+			static inline uint64_t rotl(uint64_t x, int k)
+			{
+				return (x << k) | (x >> (64 - k));
+			}
+
+			//	52 random bits as mantissa of a number from [1, 2), minus 1
+			static inline double toUnit(uint64_t bits)
+			{
+				bits = (bits >> 12) | 0x3FF0000000000000ULL;
+
+				double unit;
+				std::memcpy(&unit, &bits, sizeof(unit));
+
+				return unit - 1.0;
+			}
+
+#ifdef __AVX2__
+			//	Shift counts have to be immediate
+			template <int K>
+			static inline __m256i rotl(__m256i x)
+			{
+				return _mm256_or_si256(_mm256_slli_epi64(x, K), _mm256_srli_epi64(x, 64 - K));
+			}
+
+			//	Numbers of all lanes as doubles from [0, 1)
+			inline __m256d step()
+			{
+				__m256i s0 = _mm256_load_si256(reinterpret_cast<const __m256i*>(state_[0]));
+				__m256i s1 = _mm256_load_si256(reinterpret_cast<const __m256i*>(state_[1]));
+				__m256i s2 = _mm256_load_si256(reinterpret_cast<const __m256i*>(state_[2]));
+				__m256i s3 = _mm256_load_si256(reinterpret_cast<const __m256i*>(state_[3]));
+
+				//	AVX2 has no 64 bit multiplication, x * 5 and x * 9 are computed with shifts
+				__m256i x = _mm256_add_epi64(_mm256_slli_epi64(s1, 2), s1);
+				x = rotl<7>(x);
+				__m256i result = _mm256_add_epi64(_mm256_slli_epi64(x, 3), x);
+
+				const __m256i t = _mm256_slli_epi64(s1, 17);
+
+				s2 = _mm256_xor_si256(s2, s0);
+				s3 = _mm256_xor_si256(s3, s1);
+				s1 = _mm256_xor_si256(s1, s2);
+				s0 = _mm256_xor_si256(s0, s3);
+
+				s2 = _mm256_xor_si256(s2, t);
+				s3 = rotl<45>(s3);
+
+				_mm256_store_si256(reinterpret_cast<__m256i*>(state_[0]), s0);
+				_mm256_store_si256(reinterpret_cast<__m256i*>(state_[1]), s1);
+				_mm256_store_si256(reinterpret_cast<__m256i*>(state_[2]), s2);
+				_mm256_store_si256(reinterpret_cast<__m256i*>(state_[3]), s3);
+
+				const __m256i one = _mm256_set1_epi64x(0x3FF0000000000000LL);
+				__m256i bits = _mm256_or_si256(_mm256_srli_epi64(result, 12), one);
+
+				return _mm256_sub_pd(_mm256_castsi256_pd(bits), _mm256_set1_pd(1.0));
+			}
+#endif
+
+			inline void step(double* out)
+			{
+#ifdef __AVX2__
+				_mm256_storeu_pd(out, step());
+#else
+				for (size_t lane = 0; lane < LANES; ++lane)
+				{
+					const uint64_t result = rotl(state_[1][lane] * 5, 7) * 9;
+					const uint64_t t = state_[1][lane] << 17;
+
+					state_[2][lane] ^= state_[0][lane];
+					state_[3][lane] ^= state_[1][lane];
+					state_[1][lane] ^= state_[2][lane];
+					state_[0][lane] ^= state_[3][lane];
+
+					state_[2][lane] ^= t;
+					state_[3][lane] = rotl(state_[3][lane], 45);
+
+					out[lane] = toUnit(result);
+				}
+#endif
+			}
+
+		public:
+			explicit RandomLanes(uint64_t seed)
+			{
+				for (size_t lane = 0; lane < LANES; ++lane)
+				{
+					for (size_t word = 0; word < 4; ++word)
+						state_[word][lane] = splitmix(seed + (lane * 4 + word) * SPLITMIX_INCREMENT);
+				}
+			}
+
+			/**
+			 *	@brief	Generator seeded with one number drawn from given generator
+			 */
+			explicit RandomLanes(Random& random) : RandomLanes(random()) { }
+
+			/**
+			 *	@brief	Fills [out, out + count) with numbers uniformly distributed in [0, 1)
+			 */
+			void fillUniform(double* out, size_t count)
+			{
+				size_t i = 0;
+				for (; i + LANES <= count; i += LANES)
+					step(out + i);
+
+				if (i < count)
+				{
+					double rest[LANES];
+					step(rest);
+					std::copy(rest, rest + (count - i), out + i);
+				}
+			}
+		};
+
+		const double TWO_PI = 6.283185307179586476925286766559;
+
+		/**
+		 *	@brief	Fills [out, out + count) with standard normal numbers
+		 *
+		 *	@details Marsaglia polar method: pairs of uniform numbers from given
+		 *			 generator are drawn in blocks, pairs outside of unit circle are
+		 *			 rejected. Avoids sin and cos of Box-Muller transform
+		 */
+		inline void fillNormal(RandomLanes& lanes, double* out, size_t count)
+		{
+			const size_t BLOCK = 64;
+			double uniform[BLOCK];
+			size_t used = BLOCK;
+
+			for (size_t i = 0; i < count; )
+			{
+				if (used == BLOCK)
+				{
+					lanes.fillUniform(uniform, BLOCK);
+					used = 0;
+				}
+
+				double x = 2.0 * uniform[used] - 1.0;
+				double y = 2.0 * uniform[used + 1] - 1.0;
+				used += 2;
+
+				double square = x * x + y * y;
+				if (square >= 1.0 || square == 0.0)
+					continue;
+
+				double factor = std::sqrt(-2.0 * std::log(square) / square);
+
+				out[i++] = x * factor;
+				if (i < count)
+					out[i++] = y * factor;
+			}
+		}
+
+		/**
+		 *	@brief	Standard normal number drawn from given generator
+		 */
+		inline double normal(Random& random)
+		{
+			double radius = std::sqrt(-2.0 * std::log(1.0 - random.uniformReal()));
+			return radius * std::cos(TWO_PI * random.uniformReal());
+		}
+
+		inline double clamp(double value, double lower, double upper)
+		{
+			return std::min(std::max(value, lower), upper);
+		}
+
+		/**
+		 *	@brief	a = w * a + (1 - w) * b, b = (1 - w) * a + w * b
+		 */
+		inline void blendKernel(double* a, double* b, size_t count, double weight)
+		{
+			size_t i = 0;
+#ifdef __AVX2__
+			const __m256d w = _mm256_set1_pd(weight);
+			for (; i + 4 <= count; i += 4)
+			{
+				__m256d va = _mm256_loadu_pd(a + i);
+				__m256d vb = _mm256_loadu_pd(b + i);
+				__m256d shift = _mm256_mul_pd(w, _mm256_sub_pd(va, vb));
+
+				_mm256_storeu_pd(a + i, _mm256_add_pd(vb, shift));
+				_mm256_storeu_pd(b + i, _mm256_sub_pd(va, shift));
+			}
+#endif
+			for (; i < count; ++i)
+			{
+				double shift = weight * (a[i] - b[i]);
+				double va = a[i];
+
+				a[i] = b[i] + shift;
+				b[i] = va - shift;
+			}
+		}
+
+		/**
+		 *	@brief	BLX-alpha, children are drawn from interval spanned by parents
+		 *			widened by alpha of its length on both sides
+		 *
+		 *	@param	ua, ub	Uniform numbers from [0, 1) for children a and b
+		 *	@param	spread	1 + 2 * alpha
+		 */
+		inline void blendAlphaKernel(double* a, double* b, const double* ua, const double* ub, size_t count,
+									 double alpha, double spread, double lower, double upper)
+		{
+			size_t i = 0;
+#ifdef __AVX2__
+			const __m256d valpha = _mm256_set1_pd(alpha);
+			const __m256d vspread = _mm256_set1_pd(spread);
+			const __m256d vlower = _mm256_set1_pd(lower);
+			const __m256d vupper = _mm256_set1_pd(upper);
+
+			for (; i + 4 <= count; i += 4)
+			{
+				__m256d va = _mm256_loadu_pd(a + i);
+				__m256d vb = _mm256_loadu_pd(b + i);
+
+				__m256d low = _mm256_min_pd(va, vb);
+				__m256d length = _mm256_sub_pd(_mm256_max_pd(va, vb), low);
+				__m256d start = _mm256_sub_pd(low, _mm256_mul_pd(valpha, length));
+				__m256d width = _mm256_mul_pd(length, vspread);
+
+				__m256d ca = _mm256_add_pd(start, _mm256_mul_pd(_mm256_loadu_pd(ua + i), width));
+				__m256d cb = _mm256_add_pd(start, _mm256_mul_pd(_mm256_loadu_pd(ub + i), width));
+
+				_mm256_storeu_pd(a + i, _mm256_min_pd(_mm256_max_pd(ca, vlower), vupper));
+				_mm256_storeu_pd(b + i, _mm256_min_pd(_mm256_max_pd(cb, vlower), vupper));
+			}
+#endif
+			for (; i < count; ++i)
+			{
+				double low = std::min(a[i], b[i]);
+				double length = std::max(a[i], b[i]) - low;
+				double start = low - alpha * length;
+				double width = length * spread;
+
+				a[i] = clamp(start + ua[i] * width, lower, upper);
+				b[i] = clamp(start + ub[i] * width, lower, upper);
+			}
+		}
+
+		/**
+		 *	@brief	Children placed symmetrically around mean of parents,
+		 *			at beta times half of distance between parents
+		 */
+		inline void spreadKernel(double* a, double* b, const double* beta, size_t count, double lower, double upper)
+		{
+			size_t i = 0;
+#ifdef __AVX2__
+			const __m256d half = _mm256_set1_pd(0.5);
+			const __m256d vlower = _mm256_set1_pd(lower);
+			const __m256d vupper = _mm256_set1_pd(upper);
+
+			for (; i + 4 <= count; i += 4)
+			{
+				__m256d va = _mm256_loadu_pd(a + i);
+				__m256d vb = _mm256_loadu_pd(b + i);
+
+				__m256d mean = _mm256_mul_pd(half, _mm256_add_pd(va, vb));
+				__m256d shift = _mm256_mul_pd(_mm256_mul_pd(half, _mm256_loadu_pd(beta + i)), _mm256_sub_pd(va, vb));
+
+				_mm256_storeu_pd(a + i, _mm256_min_pd(_mm256_max_pd(_mm256_add_pd(mean, shift), vlower), vupper));
+				_mm256_storeu_pd(b + i, _mm256_min_pd(_mm256_max_pd(_mm256_sub_pd(mean, shift), vlower), vupper));
+			}
+#endif
+			for (; i < count; ++i)
+			{
+				double mean = 0.5 * (a[i] + b[i]);
+				double shift = (0.5 * beta[i]) * (a[i] - b[i]);
+
+				a[i] = clamp(mean + shift, lower, upper);
+				b[i] = clamp(mean - shift, lower, upper);
+			}
+		}
+
+		/**
+		 *	@brief	genes += scale * offsets, clamped to [lower, upper]
+		 */
+		inline void addScaledKernel(double* genes, const double* offsets, size_t count, double scale, double lower, double upper)
+		{
+			size_t i = 0;
+#ifdef __AVX2__
+			const __m256d vscale = _mm256_set1_pd(scale);
+			const __m256d vlower = _mm256_set1_pd(lower);
+			const __m256d vupper = _mm256_set1_pd(upper);
+
+			for (; i + 4 <= count; i += 4)
+			{
+				__m256d moved = _mm256_add_pd(_mm256_loadu_pd(genes + i), _mm256_mul_pd(vscale, _mm256_loadu_pd(offsets + i)));
+				_mm256_storeu_pd(genes + i, _mm256_min_pd(_mm256_max_pd(moved, vlower), vupper));
+			}
+#endif
+			for (; i < count; ++i)
+				genes[i] = clamp(genes[i] + scale * offsets[i], lower, upper);
+		}
+
+	}
+
+}
+
+#endif // !__REAL_KERNELS__
@@ -0,0 +1,228 @@
+/*
+ *  Set of predefined mutation strategies for real-coded genetic algorithms,
+ *	Genotypes are sequences of double Genes (std::vector, std::array or GeneRow)
+ *
+ *  Authors: Michal Swiatek, Michal Sulek
+ *	Update:	 17.10.2026
+ *
+ *	Github repository: https://github.com/MichalKonradSulek/ZPR
+ */
+
+#ifndef __REAL_MUTATIONS__
+#define __REAL_MUTATIONS__
+
+#include <vector>
+#include <limits>
+#include <cmath>
+#include <type_traits>
+
+#include "mutation.hpp"
+#include "random.hpp"
+#include "exception.hpp"
+#include "real_kernels.hpp"
+
+namespace ga {
+
+	/**
+	 *	@brief	Base class of mutations of real-valued Genes
+	 *
+	 *	@details Every Gene is mutated with given propability and clamped to
+	 *			 [lower, upper]. When all Genes are mutated (rate 1, default)
+	 *			 whole Genotype is mutated by mutateGenes() in one pass, otherwise
+	 *			 mutated Genes are picked like in PerGeneMutation
+	 *
+	 *	@note	override mutateGene() and mutateGenes(Gene* genes, size_t size)
+	 */
+	template <typename GeneType, typename GenotypeType = std::vector<GeneType> >
+	class RealMutation : public PerGeneMutation<GeneType, GenotypeType>
+	{
+		static_assert(std::is_same<GeneType, double>::value, "Real-coded mutations operate on double Genes");
+
+	public:
+		using Gene = typename PerGeneMutation<GeneType, GenotypeType>::Gene;
+		using Genotype = typename PerGeneMutation<GeneType, GenotypeType>::Genotype;
+		using Changes = typename PerGeneMutation<GeneType, GenotypeType>::Changes;
+
+	protected:
+		double lower_;
+		double upper_;
+
+		/**
+		 *	@brief	Mutates all Genes of Genotype
+		 */
+		virtual void mutateGenes(Gene* genes, size_t size) const = 0;
+
+		bool mutatesAll() const { return this->getGeneMutationRate() >= 1.0; }
+
+		void performMutation(Genotype& genes) const override
+		{
+			if (mutatesAll())
+				mutateGenes(genes.data(), genes.size());
+			else
+				PerGeneMutation<GeneType, GenotypeType>::performMutation(genes);
+		}
+
+		void performTrackedMutation(Genotype& genes, Changes& changes) const override
+		{
+			if (mutatesAll())
+			{
+				changes.record(genes, 0, genes.size());
+				mutateGenes(genes.data(), genes.size());
+			}
+			else
+				PerGeneMutation<GeneType, GenotypeType>::performTrackedMutation(genes, changes);
+		}
+
+	public:
+		RealMutation(double lower, double upper, double gene_mutation_rate, int mutation_chance)
+			: PerGeneMutation<GeneType, GenotypeType>(gene_mutation_rate, mutation_chance), lower_(lower), upper_(upper) { }
+
+		bool mutateTracked(Genotype& genes, Changes& changes) const override
+		{
+			if (this->overridesMutate() || !mutatesAll())
+				return PerGeneMutation<GeneType, GenotypeType>::mutateTracked(genes, changes);
+
+			if (genes.size() == 0 || !this->mutationCondition())
+				return false;
+
+			performTrackedMutation(genes, changes);
+			return true;
+		}
+
+		double getLowerBound() const { return lower_; }
+		double getUpperBound() const { return upper_; }
+	};
+
+	/**
+	 *	@brief	Mutation adding normally distributed noise to Genes
+	 *
+	 *	@details Gene x becomes x + sigma * N(0, 1), clamped to bounds. Noise
+	 *			 for whole Genotype is generated in one pass (Marsaglia polar
+	 *			 method on uniform numbers from vectorized generator)
+	 */
+	template <typename GeneType, typename GenotypeType = std::vector<GeneType> >
+	class GaussianMutation : public RealMutation<GeneType, GenotypeType>
+	{
+	public:
+		using Gene = typename RealMutation<GeneType, GenotypeType>::Gene;
+		using Genotype = typename RealMutation<GeneType, GenotypeType>::Genotype;
+		using Changes = typename RealMutation<GeneType, GenotypeType>::Changes;
+
+	private:
+		double sigma_;
+
+	protected:
+		void mutateGene(Genotype& genes, size_t position) const override
+		{
+			genes[position] = detail::clamp(genes[position] + sigma_ * detail::normal(getRandom()), this->lower_, this->upper_);
+		}
+
+		void mutateGenes(Gene* genes, size_t size) const override
+		{
+			//	Reused between calls, so mutation doesn't allocate after first call on a thread
+			thread_local std::vector<double> noise;
+			noise.resize(size);
+
+			detail::RandomLanes lanes(getRandom());
+			detail::fillNormal(lanes, noise.data(), size);
+
+			detail::addScaledKernel(genes, noise.data(), size, sigma_, this->lower_, this->upper_);
+		}
+
+	public:
+		/**
+		 *	@param	sigma				Standard deviation of noise
+		 *	@param	gene_mutation_rate	Propability of mutation of every Gene
+		 *	@param	mutation_chance		Chance that Genotype is mutated at all
+		 */
+		explicit GaussianMutation(double sigma,
+								  double lower = -std::numeric_limits<double>::infinity(),
+								  double upper = std::numeric_limits<double>::infinity(),
+								  double gene_mutation_rate = 1.0,
+								  int mutation_chance = MAX_MUTATION_CHANCE)
+			: RealMutation<GeneType, GenotypeType>(lower, upper, gene_mutation_rate, mutation_chance), sigma_(sigma) { }
+
+		double getSigma() const { return sigma_; }
+		void setSigma(double sigma) { sigma_ = sigma; }
+	};
+
+	/**
+	 *	@brief	Polynomial mutation with bounded Genes
+	 *
+	 *	@details Gene is moved towards one of bounds by distance drawn from
+	 *			 polynomial distribution with given distribution index, larger
+	 *			 index gives smaller perturbations. Commonly used with gene
+	 *			 mutation rate 1 / length of Genotype
+	 */
+	template <typename GeneType, typename GenotypeType = std::vector<GeneType> >
+	class PolynomialMutation : public RealMutation<GeneType, GenotypeType>
+	{
+	public:
+		using Gene = typename RealMutation<GeneType, GenotypeType>::Gene;
+		using Genotype = typename RealMutation<GeneType, GenotypeType>::Genotype;
+		using Changes = typename RealMutation<GeneType, GenotypeType>::Changes;
+
+	private:
+		double distribution_index_;
+
+		inline double perturb(double gene, double uniform) const
+		{
+			const double range = this->upper_ - this->lower_;
+			const double exponent = 1.0 / (distribution_index_ + 1.0);
+
+			double shift;
+			if (uniform < 0.5)
+			{
+				double reach = 1.0 - (gene - this->lower_) / range;
+				double value = 2.0 * uniform + (1.0 - 2.0 * uniform) * std::pow(reach, distribution_index_ + 1.0);
+				shift = std::pow(value, exponent) - 1.0;
+			}
+			else
+			{
+				double reach = 1.0 - (this->upper_ - gene) / range;
+				double value = 2.0 * (1.0 - uniform) + 2.0 * (uniform - 0.5) * std::pow(reach, distribution_index_ + 1.0);
+				shift = 1.0 - std::pow(value, exponent);
+			}
+
+			return detail::clamp(gene + shift * range, this->lower_, this->upper_);
+		}
+
+	protected:
+		void mutateGene(Genotype& genes, size_t position) const override
+		{
+			genes[position] = perturb(genes[position], getRandom().uniformReal());
+		}
+
+		void mutateGenes(Gene* genes, size_t size) const override
+		{
+			thread_local std::vector<double> uniform;
+			uniform.resize(size);
+
+			detail::RandomLanes lanes(getRandom());
+			lanes.fillUniform(uniform.data(), size);
+
+			for (size_t i = 0; i < size; ++i)
+				genes[i] = perturb(genes[i], uniform[i]);
+		}
+
+	public:
+		/**
+		 *	@param	lower, upper		Bounds of Genes, have to be finite
+		 *	@param	distribution_index	Shape of distribution of perturbations
+		 *	@param	gene_mutation_rate	Propability of mutation of every Gene
+		 *	@param	mutation_chance		Chance that Genotype is mutated at all
+		 */
+		PolynomialMutation(double lower, double upper,
+						   double distribution_index = 20.0,
+						   double gene_mutation_rate = 1.0,
+						   int mutation_chance = MAX_MUTATION_CHANCE)
+			: RealMutation<GeneType, GenotypeType>(lower, upper, gene_mutation_rate, mutation_chance), distribution_index_(distribution_index)
+		{
+			if (!(lower < upper) || !std::isfinite(upper - lower))
+				throw Exception("PolynomialMutation requires finite bounds with lower < upper");
+		}
+	};
+
+}
+
+#endif // !__REAL_MUTATIONS__
@@ -13,9 +13,11 @@
 #include <vector>
 #include <cstdlib>
 #include <limits>
+#include <cmath>
 #include <algorithm>
 
 #include "selection.hpp"
+#include "random.hpp"
 
 namespace ga {
 
@@ -23,39 +25,47 @@ namespace ga {
 	 *	@brief	Selection strategy that picks parents from a certain
 	 *			percent of best individuals
 	 *
-	 *	@details Populations gets sorted and parents are picked from
-	 *			 best precentage of individuals
+	 *	@details Indices of best precentage of individuals are moved to
+	 *			 the front (without sorting whole population) and parents
+	 *			 are picked from them
 	 */
 	template <typename SpecimenType>
-	class BestFitnessPercentageSelection : public Selection<SpecimenType>
+	class BestFitnessPercentageSelection : public FitnessSelection<SpecimenType>
 	{
 	public:
-		using Population = typename Selection<SpecimenType>::Population;
+		using Indices = typename FitnessSelection<SpecimenType>::Indices;
 
 	private:
 		int best_of_percent_;
 
+		Indices order_;
+
 	public:
 		explicit BestFitnessPercentageSelection(int best_of_percent = 10) : best_of_percent_(best_of_percent) { }
 		~BestFitnessPercentageSelection() = default;
 
-		Population select(const Population& population, size_t mating_pool_size) override
+		void selectFromFitness(const double* fitness, size_t size, size_t mating_pool_size, Indices& indices) override
 		{
-		    if(population.empty()) return Population();
-			Population mating_pool;
-			mating_pool.reserve(mating_pool_size);
+			indices.clear();
+			if (size == 0) return;
+
+			indices.reserve(mating_pool_size);
+
+			size_t best_count = std::max<size_t>(1, size_t((best_of_percent_ / 100.f) * size));
+			best_count = std::min(best_count, size);
 
-			Population pop = population;
+			order_.resize(size);
+			for (size_t i = 0; i < order_.size(); ++i)
+				order_[i] = i;
 
-			std::sort(pop.begin(), pop.end(), [](const auto& a, const auto& b) { return a.getFitness() > b.getFitness(); });
+			std::nth_element(order_.begin(), order_.begin() + (best_count - 1), order_.end(),
+							 [fitness](size_t a, size_t b) { return fitness[a] > fitness[b]; });
 
 			for (size_t i = 0; i < mating_pool_size; ++i)
 			{
-				int choice = rand() % int((best_of_percent_ / 100.f) * population.size());
-				mating_pool.emplace_back(pop[choice]);
+				size_t choice = getRandom().uniform(best_count);
+				indices.push_back(order_[choice]);
 			}
-
-			return mating_pool;
 		}
 	};
 
@@ -71,58 +81,48 @@ namespace ga {
 	 *	@note	This strategy doesn't work with negative fitnesses
 	 */
 	template <typename SpecimenType>
-	class RouletteWheelSelection : public Selection<SpecimenType>
+	class RouletteWheelSelection : public FitnessSelection<SpecimenType>
 	{
 	public:
-		using Population = typename Selection<SpecimenType>::Population;
+		using Indices = typename FitnessSelection<SpecimenType>::Indices;
 
-		Population select(const Population& population, size_t mating_pool_size) override
+		void selectFromFitness(const double* fitness, size_t size, size_t mating_pool_size, Indices& indices) override
 		{
 			//	Setup
-			Population mating_pool;
-			mating_pool.reserve(mating_pool_size);
+			indices.clear();
+			indices.reserve(mating_pool_size);
 
-			generateWheel(population);
+			generateWheel(fitness, size);
 
 			for (size_t i = 0; i < mating_pool_size; ++i)
 			{
 				double random_fitness = getDouble() * cumultative_fitness.back();
 
 				//	Find last occurence that is < random_fitness
-				int index = closest(cumultative_fitness, random_fitness);
-				mating_pool.emplace_back(population[index]);
+				indices.push_back(closest(cumultative_fitness, random_fitness));
 			}
-
-			return mating_pool;
 		}
 
 	protected:
 		std::vector<double> cumultative_fitness;
 
-		void generateWheel(const Population& population)
+		void generateWheel(const double* fitness, size_t size)
 		{
 			cumultative_fitness.clear();
-			cumultative_fitness.reserve(population.size());
+			cumultative_fitness.reserve(size);
 
 			//	Calculate cumulative distribution
-			cumultative_fitness.push_back(getFitness(population.front()));
-			for (size_t i = 1; i < population.size(); ++i)
-				cumultative_fitness.push_back(getFitness(population[i]) + cumultative_fitness.back());
-		}
-
-		inline double getFitness(const SpecimenType& specimen)
-		{
-			double fitness = specimen.getFitness();
-			//return fitness < 0.0 ? 0.0 : fitness;
-			return fitness;
+			cumultative_fitness.push_back(fitness[0]);
+			for (size_t i = 1; i < size; ++i)
+				cumultative_fitness.push_back(fitness[i] + cumultative_fitness.back());
 		}
 
 		inline double getDouble() const
 		{
-			return double(rand()) / RAND_MAX;
+			return getRandom().uniformReal();
 		}
 
-		inline int closest(const std::vector<double>& vec, double value)
+		inline size_t closest(const std::vector<double>& vec, double value)
 		{
 			auto it = std::lower_bound(vec.begin(), vec.end(), value);
 			if (it == vec.end())
@@ -151,16 +151,16 @@ namespace ga {
 	class StochasticUniversalSamplingSelection : public RouletteWheelSelection<SpecimenType>
 	{
 	public:
-		using Population = typename RouletteWheelSelection<SpecimenType>::Population;
+		using Indices = typename RouletteWheelSelection<SpecimenType>::Indices;
 		using Base = RouletteWheelSelection<SpecimenType>;
 
-		Population select(const Population& population, size_t mating_pool_size) override
+		void selectFromFitness(const double* fitness, size_t size, size_t mating_pool_size, Indices& indices) override
 		{
 			//	Setup
-			Population mating_pool;
-			mating_pool.reserve(mating_pool_size);
+			indices.clear();
+			indices.reserve(mating_pool_size);
 
-			Base::generateWheel(population);
+			Base::generateWheel(fitness, size);
 
 			double step = Base::cumultative_fitness.back() / mating_pool_size;
 
@@ -170,14 +170,105 @@ namespace ga {
 			for (size_t i = 0; i < mating_pool_size; ++i, random_fitness += step)
 			{
 				if (random_fitness > Base::cumultative_fitness.back())
-					random_fitness = static_cast<int>(random_fitness) % static_cast<int>(Base::cumultative_fitness.back());
+					random_fitness = std::fmod(random_fitness, Base::cumultative_fitness.back());
 
 				//	Find last occurence that is < random_fitness
-				int index = Base::closest(Base::cumultative_fitness, random_fitness);
-				mating_pool.emplace_back(population[index]);
+				indices.push_back(Base::closest(Base::cumultative_fitness, random_fitness));
 			}
+		}
+	};
+
+	/**
+	 *	@brief	Selection strategy implementing fitness proportional selection
+	 *			with alias method
+	 *
+	 *	@details Picks parents with the same propability as roulette wheel, but
+	 *			 instead of searching cumulative distribution for every parent, an
+	 *			 alias table (Vose's algorithm) is built once per generation in O(N).
+	 *			 Each parent is then drawn in O(1) - a column of table is picked
+	 *			 uniformly and a biased coin decides between column and its alias
+	 *
+	 *	@note	This strategy doesn't work with negative fitnesses
+	 *
+	 *	@see	GA::RouletteWheelSelection
+	 */
+	template <typename SpecimenType>
+	class AliasSelection : public FitnessSelection<SpecimenType>
+	{
+	public:
+		using Indices = typename FitnessSelection<SpecimenType>::Indices;
+
+		void selectFromFitness(const double* fitness, size_t size, size_t mating_pool_size, Indices& indices) override
+		{
+			//	Setup
+			indices.clear();
+			if (size == 0) return;
+
+			indices.reserve(mating_pool_size);
+
+			generateTable(fitness, size);
 
-			return mating_pool;
+			for (size_t i = 0; i < mating_pool_size; ++i)
+				indices.push_back(sample());
+		}
+
+	protected:
+		std::vector<double> probability_;
+		Indices				alias_;
+
+		//	Worklists of Vose's algorithm, kept to avoid allocations
+		Indices small_;
+		Indices large_;
+
+		void generateTable(const double* fitness, size_t n)
+		{
+			probability_.resize(n);
+			alias_.resize(n);
+			small_.clear();
+			large_.clear();
+
+			double total_fitness = 0.0;
+			for (size_t i = 0; i < n; ++i)
+				total_fitness += fitness[i];
+
+			//	Scale propabilities so that average column is equal to 1
+			for (size_t i = 0; i < n; ++i)
+			{
+				probability_[i] = total_fitness > 0.0 ? fitness[i] * n / total_fitness : 1.0;
+				alias_[i] = i;
+
+				if (probability_[i] < 1.0)
+					small_.push_back(i);
+				else
+					large_.push_back(i);
+			}
+
+			//	Fill every underfull column with excess of an overfull one
+			while (!small_.empty() && !large_.empty())
+			{
+				size_t less = small_.back();	small_.pop_back();
+				size_t more = large_.back();	large_.pop_back();
+
+				alias_[less] = more;
+				probability_[more] -= 1.0 - probability_[less];
+
+				if (probability_[more] < 1.0)
+					small_.push_back(more);
+				else
+					large_.push_back(more);
+			}
+
+			//	Remaining columns are full up to rounding errors
+			for (auto i : small_)	probability_[i] = 1.0;
+			for (auto i : large_)	probability_[i] = 1.0;
+		}
+
+		inline size_t sample() const
+		{
+			Random& random = getRandom();
+			size_t column = random.uniform(probability_.size());
+
+			return random.uniformReal() < probability_[column] ? column : alias_[column];
 		}
 	};
 
@@ -196,36 +287,40 @@ namespace ga {
 	class RankSelection : public RouletteWheelSelection<SpecimenType>
 	{
 	public:
-		using Population = typename Selection<SpecimenType>::Population;
+		using Indices = typename RouletteWheelSelection<SpecimenType>::Indices;
 		using Base = RouletteWheelSelection<SpecimenType>;
 
-		Population select(const Population& population, size_t mating_pool_size) override
+		void selectFromFitness(const double* fitness, size_t size, size_t mating_pool_size, Indices& indices) override
 		{
 			//	Setup
-			Population mating_pool;
-			mating_pool.reserve(mating_pool_size);
+			indices.clear();
+			indices.reserve(mating_pool_size);
 
-			Population pop = population;
+			//	Rank population by sorting indices, individual at position i has rank i + 1
+			order_.resize(size);
+			for (size_t i = 0; i < order_.size(); ++i)
+				order_[i] = i;
 
-			std::sort(pop.begin(), pop.end(), [](const auto& a, const auto& b) { return a.getFitness() < b.getFitness(); });
+			std::sort(order_.begin(), order_.end(), [fitness](size_t a, size_t b) { return fitness[a] < fitness[b]; });
 
-			//	Rank population
-			for (int i = 0; i < pop.size(); ++i)
-				pop[i].setFitness(i + 1);
+			Base::cumultative_fitness.clear();
+			Base::cumultative_fitness.reserve(order_.size());
 
-			Base::generateWheel(pop);
+			double rank_sum = 0.0;
+			for (size_t i = 0; i < order_.size(); ++i)
+				Base::cumultative_fitness.push_back(rank_sum += i + 1);
 
 			for (size_t i = 0; i < mating_pool_size; ++i)
 			{
 				double random_fitness = Base::getDouble() * Base::cumultative_fitness.back();
 
 				//	Find last occurence that is < random_fitness
-				int index = Base::closest(Base::cumultative_fitness, random_fitness);
-				mating_pool.emplace_back(pop[index]);
+				indices.push_back(order_[Base::closest(Base::cumultative_fitness, random_fitness)]);
 			}
-
-			return mating_pool;
 		}
+
+	protected:
+		Indices order_;
 	};
 
 	/**
@@ -237,46 +332,61 @@ namespace ga {
 	 *	@note	This strategy accepts negative fitness values
 	 */
 	template <typename SpecimenType>
-	class TournamentSelection : public Selection<SpecimenType>
+	class TournamentSelection : public FitnessSelection<SpecimenType>
 	{
 	public:
 		explicit TournamentSelection(size_t members_per_parent) : members_per_parent_(members_per_parent) { }
 		~TournamentSelection() = default;
 
-		using Population = typename RouletteWheelSelection<SpecimenType>::Population;
+		using Population = typename FitnessSelection<SpecimenType>::Population;
+		using Indices = typename FitnessSelection<SpecimenType>::Indices;
 
-		Population select(const Population& population, size_t mating_pool_size) override
+		void selectFromFitness(const double* fitness, size_t size, size_t mating_pool_size, Indices& indices) override
+		{
+			tournaments(size, mating_pool_size, indices, [fitness](size_t i) { return fitness[i]; });
+		}
+
+		//	Only candidates are compared, so fitness of whole population isn't gathered
+		void selectIndices(const Population& population, size_t mating_pool_size, Indices& indices) override
+		{
+			tournaments(population.size(), mating_pool_size, indices, [&population](size_t i) { return population[i].getFitness(); });
+		}
+
+	protected:
+		size_t members_per_parent_;
+
+		Indices candidates_;
+
+		template <typename FitnessAccessor>
+		void tournaments(size_t size, size_t mating_pool_size, Indices& indices, FitnessAccessor fitnessOf)
 		{
 			//	Setup
-			Population mating_pool;
-			mating_pool.reserve(mating_pool_size);
+			indices.clear();
+			indices.reserve(mating_pool_size);
 
-			std::vector<int> candidates(members_per_parent_);
+			candidates_.resize(members_per_parent_);
 
 			for (size_t i = 0; i < mating_pool_size; ++i)
 			{
-				pickRandomIndices(candidates, population.size());
+				pickRandomIndices(candidates_, size);
 
-				int index = pickParent(candidates, population);
-				mating_pool.emplace_back(population[index]);
+				indices.push_back(pickParent(candidates_, fitnessOf));
 			}
-
-			return mating_pool;
 		}
 
-	protected:
-		size_t members_per_parent_;
-
-		inline void pickRandomIndices(std::vector<int>& vec, size_t n)
+		inline void pickRandomIndices(Indices& vec, size_t n)
 		{
+			Random& random = getRandom();
+
 			for (size_t i = 0; i < members_per_parent_; ++i)
-				vec[i] = rand() % n;
+				vec[i] = random.uniform(n);
 		}
 
-		inline int pickParent(const std::vector<int>& vec, const Population& population)
+		template <typename FitnessAccessor>
+		inline size_t pickParent(const Indices& vec, FitnessAccessor fitnessOf)
 		{
-			auto it = std::max_element(vec.begin(), vec.end(), [&population](int a, int b) { return population[a].getFitness() < population[b].getFitness(); });
-			return it - vec.begin();
+			auto it = std::max_element(vec.begin(), vec.end(), [&fitnessOf](size_t a, size_t b) { return fitnessOf(a) < fitnessOf(b); });
+			return *it;
 		}
 	};
 
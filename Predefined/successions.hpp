@@ -0,0 +1,215 @@
+/*
+ *  Set of predefined succession strategies for genetic algorithms
+ *
+ *  Authors: Michal Swiatek, Michal Sulek
+ *	Update:	 17.10.2026
+ *
+ *	Github repository: https://github.com/MichalKonradSulek/ZPR
+ */
+
+#ifndef __SUCCESSIONS__
+#define __SUCCESSIONS__
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+#include "succession.hpp"
+
+namespace ga {
+
+	/**
+	 *	@brief	Helper base class ordering members by fitness stored in a flat array
+	 *
+	 *	@details Fitness values are copied into contiguous array once, then
+	 *			 indices are partially ordered with nth_element - Specimens are
+	 *			 never sorted nor copied
+	 */
+	template <typename SpecimenType>
+	class FitnessOrderedSuccession : public Succession<SpecimenType>
+	{
+	public:
+		using Population = typename Succession<SpecimenType>::Population;
+		using Indices = typename Succession<SpecimenType>::Indices;
+
+	protected:
+		std::vector<double>	fitness_;
+		Indices				order_;
+
+		/**
+		 *	@brief	Moves indices of count fittest members to the front of order_
+		 *
+		 *	@details Fitness of member i is fitness_[i], count has to be at most order_.size()
+		 */
+		void partitionBest(size_t count)
+		{
+			order_.resize(fitness_.size());
+			for (size_t i = 0; i < order_.size(); ++i)
+				order_[i] = i;
+
+			if (count == 0 || count >= order_.size())
+				return;
+
+			const std::vector<double>& fitness = fitness_;
+			std::nth_element(order_.begin(), order_.begin() + (count - 1), order_.end(),
+							 [&fitness](size_t a, size_t b) { return fitness[a] > fitness[b]; });
+		}
+
+		void copyFitness(const Population& population)
+		{
+			fitness_.resize(population.size());
+			for (size_t i = 0; i < population.size(); ++i)
+				fitness_[i] = population[i].getFitness();
+		}
+	};
+
+	/**
+	 *	@brief	(mu + lambda) succession
+	 *
+	 *	@details Next generation consists of best mu members of current population
+	 *			 (mu members) and offspring (lambda members) together. Survivors of
+	 *			 current population stay in place, places of eliminated ones are taken
+	 *			 by surviving offspring
+	 */
+	template <typename SpecimenType>
+	class PlusSuccession : public FitnessOrderedSuccession<SpecimenType>
+	{
+	public:
+		using Population = typename Succession<SpecimenType>::Population;
+		using Indices = typename Succession<SpecimenType>::Indices;
+
+	private:
+		Indices eliminated_;
+
+	public:
+		void succeed(Population& population, Population& offspring) override
+		{
+			size_t mu = population.size();
+
+			//	Fitness of population followed by fitness of offspring
+			this->fitness_.resize(mu + offspring.size());
+			for (size_t i = 0; i < mu; ++i)
+				this->fitness_[i] = population[i].getFitness();
+			for (size_t i = 0; i < offspring.size(); ++i)
+				this->fitness_[mu + i] = offspring[i].getFitness();
+
+			this->partitionBest(mu);
+
+			//	Number of eliminated members of population equals number of surviving offspring
+			eliminated_.assign(mu, 1);
+			for (size_t i = 0; i < mu; ++i)
+			{
+				if (this->order_[i] < mu)
+					eliminated_[this->order_[i]] = 0;
+			}
+
+			size_t place = 0;
+			for (size_t i = 0; i < mu; ++i)
+			{
+				if (this->order_[i] < mu)
+					continue;
+
+				while (eliminated_[place] == 0)
+					++place;
+
+				using std::swap;
+				swap(population[place++], offspring[this->order_[i] - mu]);
+			}
+		}
+	};
+
+	/**
+	 *	@brief	(mu, lambda) succession
+	 *
+	 *	@details Next generation consists of best mu offspring, current population
+	 *			 is discarded. Number of offspring (lambda) has to be at least mu,
+	 *			 see Environment::setOffspringSize()
+	 */
+	template <typename SpecimenType>
+	class CommaSuccession : public FitnessOrderedSuccession<SpecimenType>
+	{
+	public:
+		using Population = typename Succession<SpecimenType>::Population;
+		using Indices = typename Succession<SpecimenType>::Indices;
+
+		void succeed(Population& population, Population& offspring) override
+		{
+			size_t mu = std::min(population.size(), offspring.size());
+
+			if (mu == offspring.size())
+			{
+				population.swap(offspring);
+				return;
+			}
+
+			this->copyFitness(offspring);
+			this->partitionBest(mu);
+
+			using std::swap;
+			for (size_t i = 0; i < mu; ++i)
+				swap(population[i], offspring[this->order_[i]]);
+		}
+	};
+
+	/**
+	 *	@brief	Generational succession preserving k best members
+	 *
+	 *	@details Offspring becomes next generation, but k best members of current
+	 *			 population replace k worst offspring if they are better
+	 */
+	template <typename SpecimenType>
+	class ElitistSuccession : public FitnessOrderedSuccession<SpecimenType>
+	{
+	public:
+		using Population = typename Succession<SpecimenType>::Population;
+		using Indices = typename Succession<SpecimenType>::Indices;
+
+	private:
+		size_t elite_size_;
+
+		Indices worst_;
+
+	public:
+		explicit ElitistSuccession(size_t elite_size = 1) : elite_size_(elite_size) { }
+
+		void succeed(Population& population, Population& offspring) override
+		{
+			size_t elite_size = std::min(elite_size_, std::min(population.size(), offspring.size()));
+
+			if (elite_size > 0)
+			{
+				//	Worst offspring are the best ones for reversed fitness
+				this->copyFitness(offspring);
+				for (auto& fitness : this->fitness_)
+					fitness = -fitness;
+
+				this->partitionBest(elite_size);
+				worst_.assign(this->order_.begin(), this->order_.begin() + elite_size);
+
+				this->copyFitness(population);
+				this->partitionBest(elite_size);
+
+				//	Pair best elite with worst offspring
+				const Population& current = population;
+				auto fitter = [&current](size_t a, size_t b) { return current[a].getFitness() > current[b].getFitness(); };
+				std::sort(this->order_.begin(), this->order_.begin() + elite_size, fitter);
+				std::sort(worst_.begin(), worst_.end(), [&offspring](size_t a, size_t b) { return offspring[a].getFitness() < offspring[b].getFitness(); });
+
+				using std::swap;
+				for (size_t i = 0; i < elite_size; ++i)
+				{
+					size_t elite = this->order_[i];
+					if (population[elite].getFitness() > offspring[worst_[i]].getFitness())
+						swap(population[elite], offspring[worst_[i]]);
+				}
+			}
+
+			population.swap(offspring);
+		}
+
+		size_t getEliteSize() const { return elite_size_; }
+	};
+
+}
+
+#endif // !__SUCCESSIONS__
@@ -0,0 +1,280 @@
+/**
+ *	Checks that incremental evaluation with DeltaFitness gives the same
+ *	fitness as full evaluation after every predefined operator recording
+ *	changes, for Genotypes stored both in std::vector and std::array
+ *
+ *	Authors: Michal Swiatek, Michal Sulek
+ *	Update:	 17.10.2026
+ *
+ *	Github repository: https://github.com/MichalKonradSulek/ZPR
+ */
+
+#include "../ga.hpp"
+
+#include <iostream>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <numeric>
+#include <algorithm>
+
+const size_t NUMBER_OF_CITIES		= 64;
+const size_t NUMBER_OF_NEIGHBOURS	= 8;
+
+const int TRIALS = 500;
+
+//	Cities on integer grid with Manhattan distances, so that lengths are exact
+class GridProblem
+{
+private:
+	std::vector<int> x_;
+	std::vector<int> y_;
+	std::vector<int> neighbours_;
+
+public:
+	GridProblem()
+	{
+		for (size_t i = 0; i < NUMBER_OF_CITIES; ++i)
+		{
+			x_.push_back(int(ga::getRandom().uniform(100)));
+			y_.push_back(int(ga::getRandom().uniform(100)));
+		}
+
+		for (int a = 0; a < int(NUMBER_OF_CITIES); ++a)
+		{
+			std::vector<int> cities;
+			for (int b = 0; b < int(NUMBER_OF_CITIES); ++b)
+			{
+				if (b != a)
+					cities.push_back(b);
+			}
+
+			std::partial_sort(cities.begin(), cities.begin() + NUMBER_OF_NEIGHBOURS, cities.end(),
+							  [this, a](int b, int c) { return distance(a, b) < distance(a, c); });
+			neighbours_.insert(neighbours_.end(), cities.begin(), cities.begin() + NUMBER_OF_NEIGHBOURS);
+		}
+	}
+
+	double distance(int a, int b) const
+	{
+		return std::abs(x_[a] - x_[b]) + std::abs(y_[a] - y_[b]);
+	}
+
+	const int* neighboursBegin(int city) const { return neighbours_.data() + city * NUMBER_OF_NEIGHBOURS; }
+	const int* neighboursEnd(int city) const { return neighboursBegin(city) + NUMBER_OF_NEIGHBOURS; }
+};
+
+class Tour : public ga::IdentitySpecimen<int>
+{
+public:
+	Tour()
+	{
+		dna_.resize(NUMBER_OF_CITIES);
+		std::iota(dna_.begin(), dna_.end(), 0);
+		std::shuffle(dna_.begin(), dna_.end(), ga::getRandom());
+	}
+};
+
+class FixedTour : public ga::FixedIdentitySpecimen<int, NUMBER_OF_CITIES>
+{
+public:
+	FixedTour()
+	{
+		std::iota(dna_.begin(), dna_.end(), 0);
+		std::shuffle(dna_.begin(), dna_.end(), ga::getRandom());
+	}
+};
+
+//	Length of open path plus weighted sum of genes, so that every moved gene changes fitness
+template <typename SpecimenType>
+class TourFitness : public ga::DeltaFitness<SpecimenType>
+{
+private:
+	const GridProblem& problem_;
+
+public:
+	using Changes = typename ga::DeltaFitness<SpecimenType>::Changes;
+
+	explicit TourFitness(const GridProblem& problem) : problem_(problem) { }
+
+	double operator()(const SpecimenType& specimen) const override
+	{
+		const auto& path = specimen.getFenotypeView();
+
+		double fitness = 0.0;
+		for (size_t i = 0; i < path.size(); ++i)
+		{
+			fitness += double(i) * path[i];
+			if (i + 1 < path.size())
+				fitness += problem_.distance(path[i], path[i + 1]);
+		}
+
+		return fitness;
+	}
+
+	bool evaluateDelta(const SpecimenType& specimen, double old_fitness, const Changes& changes, double& fitness) const override
+	{
+		const auto& path = specimen.getFenotypeView();
+		fitness = old_fitness;
+
+		for (const auto& range : changes.getMergedRanges())
+		{
+			for (size_t i = range.first; i < range.last; ++i)
+				fitness += double(i) * (path[i] - changes.getOldGene(path, i));
+
+			//	Edge i connects genes i and i + 1
+			size_t first = range.first == 0 ? 0 : range.first - 1;
+			size_t last = std::min<size_t>(range.last, path.size() - 1);
+
+			for (size_t i = first; i < last; ++i)
+				fitness += problem_.distance(path[i], path[i + 1]) - problem_.distance(changes.getOldGene(path, i), changes.getOldGene(path, i + 1));
+		}
+
+		return true;
+	}
+};
+
+//	Counts Specimens evaluated incrementally and mismatches with full evaluation
+template <typename SpecimenType>
+class DeltaCheck
+{
+private:
+	TourFitness<SpecimenType> fitness_;
+
+	size_t checked_ = 0;
+	size_t failed_ = 0;
+
+public:
+	explicit DeltaCheck(const GridProblem& problem) : fitness_(problem) { }
+
+	//	Evaluates Specimen and starts recording its changes, as environment does
+	void evaluate(SpecimenType& specimen)
+	{
+		specimen.setFitness(fitness_(specimen));
+		specimen.markEvaluated();
+		specimen.getChanges().clear();
+	}
+
+	//	Specimens with full change sets would be evaluated fully, so they are skipped
+	void check(SpecimenType& specimen)
+	{
+		specimen.markModified();
+		if (specimen.getChanges().isFull())
+			return;
+
+		double delta = 0.0;
+		fitness_.evaluateDelta(specimen, specimen.getFitness(), specimen.getChanges(), delta);
+
+		++checked_;
+		if (delta != fitness_(specimen))
+			++failed_;
+	}
+
+	bool report(const std::string& name) const
+	{
+		std::cout << name << "\tchecked " << checked_ << "\tfailed " << failed_ << '\n';
+		return checked_ > 0 && failed_ == 0;
+	}
+};
+
+template <typename SpecimenType, typename MutationType>
+bool checkMutation(const GridProblem& problem, const std::string& name, const MutationType& mutation)
+{
+	DeltaCheck<SpecimenType> check(problem);
+
+	for (int i = 0; i < TRIALS; ++i)
+	{
+		SpecimenType specimen;
+		check.evaluate(specimen);
+
+		mutation.mutateTracked(specimen.getTrackedGenotype(), specimen.getChanges());
+		check.check(specimen);
+	}
+
+	return check.report(name);
+}
+
+//	Parents differ by a short reversed segment, so that children differ from them by few genes
+template <typename SpecimenType, typename CrossoverType>
+bool checkCrossover(const GridProblem& problem, const std::string& name, CrossoverType crossover)
+{
+	DeltaCheck<SpecimenType> check(problem);
+
+	for (int i = 0; i < TRIALS; ++i)
+	{
+		SpecimenType parentA;
+		SpecimenType parentB = parentA;
+
+		auto& genes = parentB.getGenotype();
+		size_t first = ga::getRandom().uniform(genes.size() - 8);
+		std::reverse(genes.begin() + first, genes.begin() + first + 2 + ga::getRandom().uniform(7));
+
+		check.evaluate(parentA);
+		check.evaluate(parentB);
+
+		crossover.crossTracked(parentA.getTrackedGenotype(), parentB.getTrackedGenotype(), parentA.getChanges(), parentB.getChanges());
+		check.check(parentA);
+		check.check(parentB);
+	}
+
+	return check.report(name);
+}
+
+//	Local search starts around genes changed by mutation, as in environment
+template <typename SpecimenType, typename LocalSearchType>
+bool checkLocalSearch(const GridProblem& problem, const std::string& name, LocalSearchType search)
+{
+	DeltaCheck<SpecimenType> check(problem);
+	ga::InverseGenesMutation<int, typename SpecimenType::Genotype> mutation(8, ga::MAX_MUTATION_CHANCE);
+
+	for (int i = 0; i < TRIALS; ++i)
+	{
+		SpecimenType specimen;
+		search.improve(specimen.getGenotype());
+		check.evaluate(specimen);
+
+		mutation.mutateTracked(specimen.getTrackedGenotype(), specimen.getChanges());
+		search.improveTracked(specimen.getTrackedGenotype(), specimen.getChanges());
+		check.check(specimen);
+	}
+
+	return check.report(name);
+}
+
+template <typename SpecimenType>
+bool checkOperators(const GridProblem& problem)
+{
+	using Genotype = typename SpecimenType::Genotype;
+
+	bool passed = true;
+
+	passed &= checkMutation<SpecimenType>(problem, "swap", ga::SwapGeneMutation<int, Genotype>(-1, ga::MAX_MUTATION_CHANCE, 3, 3));
+	passed &= checkMutation<SpecimenType>(problem, "scramble", ga::ScrambleGenesMutation<int, Genotype>(8, ga::MAX_MUTATION_CHANCE));
+	passed &= checkMutation<SpecimenType>(problem, "inverse", ga::InverseGenesMutation<int, Genotype>(8, ga::MAX_MUTATION_CHANCE));
+
+	passed &= checkCrossover<SpecimenType>(problem, "OX", ga::OrderCrossover<int, Genotype>());
+	passed &= checkCrossover<SpecimenType>(problem, "PMX", ga::PartiallyMappedCrossover<int, Genotype>());
+	passed &= checkCrossover<SpecimenType>(problem, "CX", ga::CycleCrossover<int, Genotype>());
+	passed &= checkCrossover<SpecimenType>(problem, "ERX", ga::EdgeRecombinationCrossover<int, Genotype>());
+
+	passed &= checkLocalSearch<SpecimenType>(problem, "2-opt", ga::TwoOptSearch<int, GridProblem, Genotype>(problem));
+	passed &= checkLocalSearch<SpecimenType>(problem, "Or-opt", ga::OrOptSearch<int, GridProblem, Genotype>(problem));
+
+	return passed;
+}
+
+int main()
+{
+	ga::getRandom().setSeed(0);
+
+	GridProblem problem;
+	bool passed = true;
+
+	std::cout << "Genotype stored in std::vector\n";
+	passed &= checkOperators<Tour>(problem);
+
+	std::cout << "Genotype stored in std::array\n";
+	passed &= checkOperators<FixedTour>(problem);
+
+	return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,196 @@
+/**
+ *	Checks FitnessCache lookups under hash collisions and CLOCK eviction
+ *	and counters of cache hits and misses kept by Environment
+ *
+ *	Authors: Michal Swiatek, Michal Sulek
+ *	Update:	 17.10.2026
+ *
+ *	Github repository: https://github.com/MichalKonradSulek/ZPR
+ */
+
+#include "../ga.hpp"
+
+#include <iostream>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <atomic>
+
+using Key = std::vector<int>;
+
+const size_t GENOME_LENGTH		= 3;
+const size_t POPULATION_SIZE	= 100;
+const int	 GENERATIONS		= 20;
+
+const int	 EVICTION_KEYS		= 64;
+const int	 EVICTION_STEPS		= 2000;
+
+//	Every Genotype has the same hash, so lookups rely on full comparison
+struct CollidingHash
+{
+	uint64_t operator()(const Key&) const { return 7; }
+};
+
+//	Four hashes at the end of lookup table, so that probe sequences are long and wrap around
+struct ClusteredHash
+{
+	uint64_t operator()(const Key& key) const { return 30 + key[0] % 4; }
+};
+
+class BoolSpecimen : public ga::IdentitySpecimen<bool>
+{
+public:
+	BoolSpecimen()
+	{
+		for (size_t i = 0; i < GENOME_LENGTH; ++i)
+			dna_.push_back(ga::getRandom().uniform(2) == 1);
+	}
+};
+
+bool report(const std::string& name, bool passed)
+{
+	std::cout << name << '\t' << (passed ? "passed" : "failed") << '\n';
+	return passed;
+}
+
+bool checkCollisions()
+{
+	ga::FitnessCache<Key, CollidingHash> cache(8);
+
+	Key a{ 1 }, b{ 2 }, c{ 3 };
+	cache.insert(a, cache.hash(a), 1.0);
+	cache.insert(b, cache.hash(b), 2.0);
+
+	double fitness_a = 0.0, fitness_b = 0.0, fitness_c = 0.0;
+	bool passed = cache.find(a, cache.hash(a), fitness_a) && fitness_a == 1.0;
+	passed &= cache.find(b, cache.hash(b), fitness_b) && fitness_b == 2.0;
+	passed &= !cache.find(c, cache.hash(c), fitness_c);
+
+	//	Inserting stored Genotype updates its entry
+	cache.insert(a, cache.hash(a), 3.0);
+	passed &= cache.find(a, cache.hash(a), fitness_a) && fitness_a == 3.0 && cache.size() == 2;
+
+	return report("collisions", passed);
+}
+
+//	Cache is compared with a model of CLOCK eviction after every operation
+bool checkEviction()
+{
+	const size_t capacity = 16;
+	ga::FitnessCache<Key, ClusteredHash> cache(capacity);
+
+	std::vector<int>	slots;
+	std::vector<bool>	referenced;
+	size_t				hand = 0;
+
+	auto fitnessOf = [](int key) { return 0.5 * key; };
+	auto modelSlot = [&slots](int key)
+	{
+		for (size_t i = 0; i < slots.size(); ++i)
+		{
+			if (slots[i] == key)
+				return i;
+		}
+
+		return slots.size();
+	};
+
+	bool passed = true;
+	for (int step = 0; step < EVICTION_STEPS && passed; ++step)
+	{
+		int key = int(ga::getRandom().uniform(EVICTION_KEYS));
+		Key genotype{ key };
+
+		double fitness;
+		bool found = cache.find(genotype, cache.hash(genotype), fitness);
+
+		size_t slot = modelSlot(key);
+		passed &= found == (slot != slots.size());
+
+		if (found)
+		{
+			passed &= fitness == fitnessOf(key);
+			referenced[slot] = true;
+			continue;
+		}
+
+		cache.insert(genotype, cache.hash(genotype), fitnessOf(key));
+
+		if (slots.size() < capacity)
+		{
+			slots.push_back(key);
+			referenced.push_back(false);
+			continue;
+		}
+
+		while (referenced[hand])
+		{
+			referenced[hand] = false;
+			hand = (hand + 1) % capacity;
+		}
+
+		slots[hand] = key;
+		hand = (hand + 1) % capacity;
+	}
+
+	passed &= cache.size() == slots.size();
+
+	//	Every remaining entry is reachable after backward shift deletions
+	for (int key = 0; key < EVICTION_KEYS; ++key)
+	{
+		Key genotype{ key };
+
+		double fitness;
+		bool found = cache.find(genotype, cache.hash(genotype), fitness);
+		passed &= found == (modelSlot(key) != slots.size()) && (!found || fitness == fitnessOf(key));
+	}
+
+	return report("eviction", passed);
+}
+
+//	With few distinct Genotypes later generations are found in cache
+bool checkStatistics()
+{
+	std::atomic<size_t> evaluations(0);
+	auto fitness = [&evaluations](const BoolSpecimen& specimen)
+	{
+		evaluations.fetch_add(1, std::memory_order_relaxed);
+
+		double result = 1.0;
+		for (auto gene : specimen.getFenotypeView())
+			result += gene;
+
+		return result;
+	};
+
+	ga::Environment<BoolSpecimen> env(POPULATION_SIZE);
+	env.setMutationType<ga::FlipBitMutation>(10 * ga::MUTATION_CHANCE_PERCENT);
+	env.setEvaluationCache(POPULATION_SIZE);
+
+	auto neverFinish = [](const auto&) { return false; };
+	env.runSimulation(fitness, neverFinish, GENERATIONS, false);
+
+	const ga::EvaluationStatistics& statistics = env.getEvaluationStatistics();
+	bool passed = statistics.hits > 0 && statistics.misses == evaluations.load();
+
+	//	First generation is evaluated in full, then every member is counted once per generation
+	passed &= statistics.skipped + statistics.hits + statistics.misses == POPULATION_SIZE * (GENERATIONS + 1);
+
+	for (const auto& member : env.getBestSpecimens(POPULATION_SIZE))
+		passed &= member.getFitness() == fitness(member);
+
+	std::cout << "skipped " << statistics.skipped << "\thits " << statistics.hits << "\tmisses " << statistics.misses << '\n';
+	return report("statistics", passed);
+}
+
+int main()
+{
+	ga::getRandom().setSeed(0);
+
+	bool passed = true;
+	passed &= checkCollisions();
+	passed &= checkEviction();
+	passed &= checkStatistics();
+
+	return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
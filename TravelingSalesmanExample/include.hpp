@@ -2,77 +2,134 @@
 #define __INCLUDE__
 
 #include "../ga.hpp"
+#include "tsp_instance.hpp"
 
 #include <iostream>
 #include <ctime>
 #include <cstdlib>
 
-#include <array>
+#include <vector>
 #include <utility>
 #include <algorithm>
 
 //	Max x and y
 const int DIMENSIONS = 100;
 
+//	Size of generated instance used when no TSPLIB file is given
 constexpr int NUMBER_OF_CITIES = 25;
 
-class Specimen : public ga::Specimen<int, int>
+class Specimen : public ga::IdentitySpecimen<int>
 {
+private:
+	static int& numberOfCities()
+	{
+		static int number_of_cities = NUMBER_OF_CITIES;
+		return number_of_cities;
+	}
+
+	//	Incremental evaluations since last full one, copies inherit it together with fitness
+	mutable int delta_evaluations_ = 0;
+
 public:
 	Specimen()
 	{
-		dna_.reserve(NUMBER_OF_CITIES);
-		for (int i = 0; i < NUMBER_OF_CITIES; ++i)
+		int number_of_cities = numberOfCities();
+
+		dna_.reserve(number_of_cities);
+		for (int i = 0; i < number_of_cities; ++i)
 			dna_.emplace_back(i);
 
-		std::random_shuffle(dna_.begin(), dna_.end());
+		std::shuffle(dna_.begin(), dna_.end(), ga::getRandom());
 	}
 
-	Fenotype getFenotype() const override
+	void print() const override
 	{
-		return dna_;
+		for (const auto& city : dna_)
+			std::cout << city << ' ';
+
+		ga::IdentitySpecimen<int>::print();
 	}
 
-	void print() const override
+	//	Every city is visited exactly once
+	bool isValidPath() const
 	{
+		std::vector<bool> visited(dna_.size(), false);
 		for (const auto& city : dna_)
-			std::cout << city << ' ';
+		{
+			if (city < 0 || city >= static_cast<int>(dna_.size()) || visited[city])
+				return false;
 
-		ga::Specimen<int, int>::print();
+			visited[city] = true;
+		}
+
+		return true;
 	}
+
+	//	Called by fitness function, which gets Specimen as const
+	int countDeltaEvaluation() const { return ++delta_evaluations_; }
+	void resetDeltaEvaluations() const { delta_evaluations_ = 0; }
+
+	//	Has to be set before population is generated
+	static void setNumberOfCities(int number_of_cities) { numberOfCities() = number_of_cities; }
+	static int getNumberOfCities() { return numberOfCities(); }
 };
 
-class UniqueCrossover : public ga::Crossover<int>
+//	Length of path is updated only around genes moved by mutation
+class PathFitness : public ga::DeltaFitness<Specimen>
 {
+private:
+	//	Length is recovered from fitness with rounding error, so it is recomputed
+	//	in full after this many incremental evaluations
+	static constexpr int MAX_DELTA_EVALUATIONS = 32;
+
+	const TspInstance& instance_;
+
+	double distance(int a, int b) const
+	{
+		return instance_.distance(a, b);
+	}
+
+	static double toFitness(double length) { return 1000.0 / (length + 1); }
+	static double toLength(double fitness) { return 1000.0 / fitness - 1; }
+
 public:
-	void cross(Genotype& parentA, Genotype& parentB) override
+	explicit PathFitness(const TspInstance& instance) : instance_(instance) { }
+
+	double getLength(double fitness) const { return toLength(fitness); }
+
+	double operator()(const Specimen& specimen) const override
 	{
-		Genotype newA;	newA.reserve(parentA.size());
-		Genotype newB;  newB.reserve(parentB.size());
+		const auto& path = specimen.getFenotypeView();
+		specimen.resetDeltaEvaluations();
 
-		size_t cross_point = rand() % parentA.size();
+		//	Calculate total distance
+		double length = 0.0;
+		for (size_t i = 0; i + 1 < path.size(); ++i)
+			length += distance(path[i], path[i + 1]);
 
-		auto itA = parentA.begin() + cross_point;
-		auto itB = parentB.begin() + cross_point;
+		return toFitness(length);
+	}
 
-		for (size_t i = 0; i < parentA.size(); ++i)
-		{
-			//	Insert genes only if they are unique
-			if (std::find(itB, parentB.end(), parentB[i]) == parentB.end())
-				newA.emplace_back(parentB[i]);
+	bool evaluateDelta(const Specimen& specimen, double old_fitness, const Changes& changes, double& fitness) const override
+	{
+		if (specimen.countDeltaEvaluation() > MAX_DELTA_EVALUATIONS)
+			return false;
 
-			if (std::find(itA, parentA.end(), parentA[i]) == parentA.end())
-				newB.emplace_back(parentA[i]);
-		}
+		const auto& path = specimen.getFenotypeView();
+		double length = toLength(old_fitness);
 
-		for (; itA != parentA.end(); ++itA, ++itB)
+		//	Edge i connects cities i and i + 1, only edges touching changed cities differ
+		for (const auto& range : changes.getMergedRanges())
 		{
-			newA.emplace_back(*itB);
-			newB.emplace_back(*itA);
+			size_t first = range.first == 0 ? 0 : range.first - 1;
+			size_t last = std::min(range.last, path.size() - 1);
+
+			for (size_t i = first; i < last; ++i)
+				length += distance(path[i], path[i + 1]) - distance(changes.getOldGene(path, i), changes.getOldGene(path, i + 1));
 		}
 
-		parentA = std::move(newA);
-		parentB = std::move(newB);
+		fitness = toFitness(length);
+		return true;
 	}
 };
 
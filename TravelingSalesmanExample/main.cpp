@@ -1,47 +1,67 @@
 #include "include.hpp"
 
-int main() {
-	srand(time(nullptr));
+//	Number of generations without improvement finishing evolution on loaded instance
+constexpr uint64_t STALL_GENERATIONS = 200;
 
-	//	Define cities
-	std::array<std::pair<int, int>, NUMBER_OF_CITIES> cities;
-	for (size_t i = 0; i < NUMBER_OF_CITIES; ++i)
-		cities[i] = std::make_pair(i, i);	//	Generate predictable solution
-		//cities[i] = std::make_pair(rand() % DIMENSIONS, rand() % DIMENSIONS);
+int main(int argc, char* argv[]) {
+	ga::getRandom().setSeed(time(nullptr));
+
+	//	Define cities, TSPLIB instance can be given as an argument
+	auto loadInstance = [argc, argv]()
+	{
+		if (argc > 1)
+			return TspInstance::loadTsplib(argv[1]);
+
+		std::vector<double> x(NUMBER_OF_CITIES), y(NUMBER_OF_CITIES);
+		for (size_t i = 0; i < NUMBER_OF_CITIES; ++i)
+		{
+			x[i] = y[i] = i;	//	Generate predictable solution
+			//x[i] = ga::getRandom().uniform(DIMENSIONS); y[i] = ga::getRandom().uniform(DIMENSIONS);
+		}
+
+		return TspInstance(std::move(x), std::move(y));
+	};
+
+	const TspInstance cities = loadInstance();
+	const bool predictable = argc <= 1;
+
+	//	Genotype length has to be known before population is generated
+	Specimen::setNumberOfCities(cities.size());
 
 	ga::Environment<Specimen> env(500);
 
 	env.setMutationType<ga::SwapGeneMutation>(-1, ga::MUTATION_CHANCE_PERCENT * 10, 5);
-	env.setCrossoverType<UniqueCrossover>();
+	env.setCrossoverType<ga::OrderCrossover>();
 	env.setSelectionType<ga::StochasticUniversalSamplingSelection>();
 
-	auto fitness = [&cities](const Specimen& specimen) -> double
-	{
-		auto fenotype = specimen.getFenotype();
-
-		//	Calculate total distance
-		double dist = 0.0;
-		for (size_t i = 0; i < fenotype.size() - 1; ++i)
-		{
-			auto city1 = cities[fenotype[i    ]];
-			auto city2 = cities[fenotype[i + 1]];
+	//	Memetic stage, offspring are improved with 2-opt moves (path isn't closed)
+	env.setLocalSearchType<ga::TwoOptSearch>(cities, false);
+	env.setLocalSearchRate(0.2);
 
-			int x_diff = city1.first - city2.first;
-			int y_diff = city1.second - city2.second;
+	//	Fitness function only reads cities, so population can be evaluated in parallel,
+	//	at least 4 threads are used, so paths are checked for races of operators below
+	env.setExecutor<ga::ThreadPoolExecutor>(std::max(4u, std::thread::hardware_concurrency()));
 
-			dist += x_diff * x_diff + y_diff * y_diff;
-		}
+	//	Mutated paths are evaluated incrementally
+	PathFitness fitness(cities);
 
-		return 1000.0 / (dist + 1);
-	};
+	double best_fitness = 0.0;
+	uint64_t best_generation = 0;
 
-	auto finishCondition = [](const auto& population)
+	auto finishCondition = [predictable, &best_fitness, &best_generation](const auto& population, const ga::GenerationStats& stats)
 	{
-		ga::SpecimenComp<Specimen> comp;
+		if (!predictable)
+		{
+			if (stats.best > best_fitness)
+			{
+				best_fitness = stats.best;
+				best_generation = stats.generation;
+			}
 
-		auto best = std::max_element(population.begin(), population.end(), comp);
+			return stats.generation - best_generation >= STALL_GENERATIONS;
+		}
 
-		auto best_fenotype = (*best).getFenotype();
+		const auto& best_fenotype = population[stats.best_index].getFenotypeView();
 
 		int counter1 = 0, counter2 = 0;
 		for (int i = 0; i < NUMBER_OF_CITIES; ++i)
@@ -61,12 +81,37 @@ int main() {
 
 	env.runSimulation(fitness, finishCondition, -1, false);
 
-	auto best = env.getBest();
+	//	Operators run concurrently must leave every path a permutation of cities
+	for (const auto& specimen : env.getPopulation())
+	{
+		if (!specimen.isValidPath())
+		{
+			std::cerr << "Invalid path in population\n";
+			return EXIT_FAILURE;
+		}
+	}
+
+	//	Incrementally updated fitness must not drift from full evaluation
+	for (const auto& specimen : env.getPopulation())
+	{
+		if (std::abs(specimen.getFitness() - fitness(specimen)) > 1e-9 * specimen.getFitness())
+		{
+			std::cerr << "Incremental fitness differs from full evaluation\n";
+			return EXIT_FAILURE;
+		}
+	}
+
+	const auto& best = env.getBest();
+
+	if (predictable)
+	{
+		for (const auto& city : best.getFenotypeView())
+			std::cout << city << ' ';
 
-	for (const auto& city : best.getFenotype())
-		std::cout << city << ' ';
+		std::cout << '\n';
+	}
 
-	std::cout << '\n';
+	std::cout << "Path length: " << fitness.getLength(best.getFitness()) << '\n';
 
 	return 0;
 }
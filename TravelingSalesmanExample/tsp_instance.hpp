@@ -0,0 +1,335 @@
+/**
+ *	Instance of traveling salesman problem loaded at runtime: city
+ *	coordinates, distances and candidate lists of nearest neighbours
+ *
+ *	Authors: Michal Swiatek, Michal Sulek
+ *	Update:	 17.10.2026
+ *
+ *	Github repository: https://github.com/MichalKonradSulek/ZPR
+ */
+
+#ifndef __TSP_INSTANCE__
+#define __TSP_INSTANCE__
+
+#include "../exception.hpp"
+
+#include <cmath>
+#include <cctype>
+#include <utility>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <sstream>
+#include <istream>
+#include <algorithm>
+
+/**
+ *	@brief	Metric used to compute distance between cities
+ *
+ *	@details Euclidean		  - exact euclidean distance
+ *			 EuclideanRounded - euclidean distance rounded to nearest integer (TSPLIB EUC_2D)
+ *			 EuclideanCeiled  - euclidean distance rounded up (TSPLIB CEIL_2D)
+ *			 Pseudoeuclidean  - pseudo euclidean distance (TSPLIB ATT)
+ */
+enum class DistanceType
+{
+	Euclidean,
+	EuclideanRounded,
+	EuclideanCeiled,
+	Pseudoeuclidean
+};
+
+/**
+ *	@brief	Set of cities with distances between them
+ *
+ *	@details Coordinates are kept in separate arrays (structure of arrays). For
+ *			 instances up to matrix limit all distances are precomputed into flat
+ *			 row major matrix, bigger instances compute distances on the fly, so
+ *			 memory stays linear in number of cities. For every city k nearest
+ *			 neighbours are found with uniform grid and kept in one flat array
+ *
+ *	@note	Cities are numbered from 0, TSPLIB numbering starting with 1 is shifted
+ */
+class TspInstance
+{
+public:
+	using size_type = size_t;
+	using City = int;
+
+	//	Matrix of 4096 cities takes 64 MiB
+	static constexpr size_type DEFAULT_MATRIX_LIMIT = 4096;
+	static constexpr size_type DEFAULT_NEIGHBOURS = 10;
+
+private:
+	std::string name_;
+
+	DistanceType distance_type_;
+
+	std::vector<double> x_;
+	std::vector<double> y_;
+
+	std::vector<float> matrix_;
+
+	size_type			number_of_neighbours_;
+	std::vector<City>	neighbours_;
+
+	double computeDistance(City a, City b) const
+	{
+		double x_diff = x_[a] - x_[b];
+		double y_diff = y_[a] - y_[b];
+
+		switch (distance_type_)
+		{
+		case DistanceType::EuclideanRounded:
+			return std::floor(std::sqrt(x_diff * x_diff + y_diff * y_diff) + 0.5);
+
+		case DistanceType::EuclideanCeiled:
+			return std::ceil(std::sqrt(x_diff * x_diff + y_diff * y_diff));
+
+		case DistanceType::Pseudoeuclidean:
+		{
+			double distance = std::sqrt((x_diff * x_diff + y_diff * y_diff) / 10.0);
+			double rounded = std::floor(distance + 0.5);
+			return rounded < distance ? rounded + 1.0 : rounded;
+		}
+
+		default:
+			return std::sqrt(x_diff * x_diff + y_diff * y_diff);
+		}
+	}
+
+	void buildMatrix(size_type matrix_limit)
+	{
+		matrix_.clear();
+		if (size() > matrix_limit)
+			return;
+
+		matrix_.resize(size() * size());
+		for (size_type a = 0; a < size(); ++a)
+		{
+			matrix_[a * size() + a] = 0.0f;
+			for (size_type b = a + 1; b < size(); ++b)
+				matrix_[a * size() + b] = matrix_[b * size() + a] = static_cast<float>(computeDistance(a, b));
+		}
+	}
+
+	/**
+	 *	@brief	Finds k nearest neighbours of every city
+	 *
+	 *	@details Cities are bucketed into grid with about two cities per cell,
+	 *			 rings of cells around a city are searched until k candidates
+	 *			 are found and next ring can't contain closer city
+	 */
+	void buildNeighbours()
+	{
+		size_type k = std::min(number_of_neighbours_, size() == 0 ? 0 : size() - 1);
+		number_of_neighbours_ = k;
+		neighbours_.assign(size() * k, 0);
+		if (k == 0)
+			return;
+
+		double min_x = *std::min_element(x_.begin(), x_.end());
+		double max_x = *std::max_element(x_.begin(), x_.end());
+		double min_y = *std::min_element(y_.begin(), y_.end());
+		double max_y = *std::max_element(y_.begin(), y_.end());
+
+		long long grid = std::max(1LL, static_cast<long long>(std::sqrt(size() / 2.0)));
+		double cell_width = std::max((max_x - min_x) / grid, 1e-9);
+		double cell_height = std::max((max_y - min_y) / grid, 1e-9);
+
+		auto cellX = [&](City city) { return std::min(grid - 1, static_cast<long long>((x_[city] - min_x) / cell_width)); };
+		auto cellY = [&](City city) { return std::min(grid - 1, static_cast<long long>((y_[city] - min_y) / cell_height)); };
+
+		//	Counting sort of cities by cell
+		std::vector<size_type> cell_begin(grid * grid + 1, 0);
+		for (size_type city = 0; city < size(); ++city)
+			++cell_begin[cellY(city) * grid + cellX(city) + 1];
+		for (size_type cell = 0; cell < cell_begin.size() - 1; ++cell)
+			cell_begin[cell + 1] += cell_begin[cell];
+
+		std::vector<City> cell_cities(size());
+		std::vector<size_type> position(cell_begin.begin(), cell_begin.end() - 1);
+		for (size_type city = 0; city < size(); ++city)
+			cell_cities[position[cellY(city) * grid + cellX(city)]++] = city;
+
+		std::vector<std::pair<double, City> > candidates;
+		for (size_type city = 0; city < size(); ++city)
+		{
+			long long cx = cellX(city), cy = cellY(city);
+			candidates.clear();
+
+			for (long long ring = 0; ring <= grid; ++ring)
+			{
+				for (long long y = cy - ring; y <= cy + ring; ++y)
+				{
+					if (y < 0 || y >= grid)
+						continue;
+
+					for (long long x = cx - ring; x <= cx + ring; ++x)
+					{
+						//	Only border of the ring is new
+						if (x < 0 || x >= grid || (y != cy - ring && y != cy + ring && x != cx - ring && x != cx + ring))
+							continue;
+
+						size_type cell = y * grid + x;
+						for (size_type i = cell_begin[cell]; i < cell_begin[cell + 1]; ++i)
+						{
+							if (cell_cities[i] != static_cast<City>(city))
+								candidates.emplace_back(geometricDistance(city, cell_cities[i]), cell_cities[i]);
+						}
+					}
+				}
+
+				//	Every city outside of searched rings is further than ring * cell size
+				if (candidates.size() >= k)
+				{
+					std::nth_element(candidates.begin(), candidates.begin() + (k - 1), candidates.end());
+					if (candidates[k - 1].first <= ring * std::min(cell_width, cell_height))
+						break;
+				}
+			}
+
+			std::partial_sort(candidates.begin(), candidates.begin() + k, candidates.end());
+			for (size_type i = 0; i < k; ++i)
+				neighbours_[city * k + i] = candidates[i].second;
+		}
+	}
+
+	double geometricDistance(City a, City b) const
+	{
+		double x_diff = x_[a] - x_[b];
+		double y_diff = y_[a] - y_[b];
+
+		return std::sqrt(x_diff * x_diff + y_diff * y_diff);
+	}
+
+public:
+	/**
+	 *	@param	x, y					Coordinates of cities
+	 *	@param	distance_type			Metric of distance
+	 *	@param	number_of_neighbours	Length of candidate list of every city
+	 *	@param	matrix_limit			Maximal number of cities with precomputed distance matrix
+	 */
+	TspInstance(std::vector<double> x, std::vector<double> y,
+				DistanceType distance_type = DistanceType::Euclidean,
+				size_type number_of_neighbours = DEFAULT_NEIGHBOURS,
+				size_type matrix_limit = DEFAULT_MATRIX_LIMIT)
+		: distance_type_(distance_type), x_(std::move(x)), y_(std::move(y)), number_of_neighbours_(number_of_neighbours)
+	{
+		if (x_.size() != y_.size())
+			throw ga::Exception("TspInstance: numbers of x and y coordinates differ");
+
+		buildMatrix(matrix_limit);
+		buildNeighbours();
+	}
+
+	/**
+	 *	@brief	Loads instance in TSPLIB format
+	 *
+	 *	@details Supported are instances of TYPE TSP with NODE_COORD_SECTION and
+	 *			 EDGE_WEIGHT_TYPE EUC_2D, CEIL_2D or ATT
+	 */
+	static TspInstance loadTsplib(std::istream& stream,
+								  size_type number_of_neighbours = DEFAULT_NEIGHBOURS,
+								  size_type matrix_limit = DEFAULT_MATRIX_LIMIT)
+	{
+		std::string name;
+		DistanceType distance_type = DistanceType::EuclideanRounded;
+		size_type dimension = 0;
+
+		std::string line;
+		bool coordinates = false;
+		while (std::getline(stream, line))
+		{
+			size_type colon = line.find(':');
+			std::string key = line.substr(0, colon);
+			key.erase(std::remove_if(key.begin(), key.end(), [](unsigned char c) { return std::isspace(c); }), key.end());
+
+			std::string value;
+			if (colon != std::string::npos)
+			{
+				std::istringstream value_stream(line.substr(colon + 1));
+				value_stream >> value;
+			}
+
+			if (key == "NAME")
+				name = value;
+			else if (key == "DIMENSION")
+				dimension = std::stoul(value);
+			else if (key == "TYPE" && value != "TSP")
+				throw ga::Exception(("TspInstance: unsupported TYPE " + value).c_str());
+			else if (key == "EDGE_WEIGHT_TYPE")
+			{
+				if (value == "EUC_2D")
+					distance_type = DistanceType::EuclideanRounded;
+				else if (value == "CEIL_2D")
+					distance_type = DistanceType::EuclideanCeiled;
+				else if (value == "ATT")
+					distance_type = DistanceType::Pseudoeuclidean;
+				else
+					throw ga::Exception(("TspInstance: unsupported EDGE_WEIGHT_TYPE " + value).c_str());
+			}
+			else if (key == "NODE_COORD_SECTION")
+			{
+				coordinates = true;
+				break;
+			}
+		}
+
+		if (!coordinates || dimension == 0)
+			throw ga::Exception("TspInstance: missing DIMENSION or NODE_COORD_SECTION");
+
+		std::vector<double> x(dimension), y(dimension);
+		for (size_type i = 0; i < dimension; ++i)
+		{
+			size_type id;
+			if (!(stream >> id >> x[i] >> y[i]) || id != i + 1)
+				throw ga::Exception("TspInstance: malformed NODE_COORD_SECTION");
+		}
+
+		TspInstance instance(std::move(x), std::move(y), distance_type, number_of_neighbours, matrix_limit);
+		instance.name_ = name;
+
+		return instance;
+	}
+
+	static TspInstance loadTsplib(const std::string& path,
+								  size_type number_of_neighbours = DEFAULT_NEIGHBOURS,
+								  size_type matrix_limit = DEFAULT_MATRIX_LIMIT)
+	{
+		std::ifstream file(path);
+		if (!file)
+			throw ga::Exception(("TspInstance: can't open " + path).c_str());
+
+		return loadTsplib(file, number_of_neighbours, matrix_limit);
+	}
+
+	size_type size() const { return x_.size(); }
+
+	const std::string& getName() const { return name_; }
+
+	DistanceType getDistanceType() const { return distance_type_; }
+
+	bool hasMatrix() const { return !matrix_.empty(); }
+
+	double distance(City a, City b) const
+	{
+		if (!matrix_.empty())
+			return matrix_[a * size() + b];
+
+		return computeDistance(a, b);
+	}
+
+	/**
+	 *	@brief	Nearest neighbours of city sorted by distance
+	 */
+	const City* neighboursBegin(City city) const { return neighbours_.data() + city * number_of_neighbours_; }
+	const City* neighboursEnd(City city) const { return neighboursBegin(city) + number_of_neighbours_; }
+
+	size_type getNumberOfNeighbours() const { return number_of_neighbours_; }
+
+	double getX(City city) const { return x_[city]; }
+	double getY(City city) const { return y_[city]; }
+};
+
+#endif // !__TSP_INSTANCE__
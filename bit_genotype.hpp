@@ -0,0 +1,247 @@
+/**
+ *	Genotype storing boolean genes packed into 64 bit words. Used
+ *	instead of std::vector<bool> by binary encoded problems, so that
+ *	genetic operators can work on whole words instead of single bits
+ *	accessed trough proxy references
+ *
+ *	Authors: Michal Swiatek, Michal Sulek
+ *	Update:	 17.10.2026
+ *
+ *	Github repository: https://github.com/MichalKonradSulek/ZPR
+ */
+
+#ifndef __BIT_GENOTYPE__
+#define __BIT_GENOTYPE__
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace ga {
+
+	/**
+	 *	@brief	Number of set bits in a word
+	 */
+	inline size_t popcount(uint64_t word)
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		return __builtin_popcountll(word);
+#elif defined(_MSC_VER) && defined(_M_X64)
+		return __popcnt64(word);
+#else
+		word = word - ((word >> 1) & 0x5555555555555555ULL);
+		word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+		word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+		return (word * 0x0101010101010101ULL) >> 56;
+#endif
+	}
+
+	/**
+	 *	@brief	Container of boolean genes packed into 64 bit words
+	 *
+	 *	@details Bit i is stored in word i / 64 at position i % 64. Unused bits of
+	 *			 last word are always kept equal to zero, so whole words can be
+	 *			 compared, counted and xored without masking. Use it as GenotypeType
+	 *			 of Specimen<bool, Chromosome, BitGenotype> together with word level
+	 *			 operators: SinglePointCrossover, MultiplePointCrossover,
+	 *			 UniformCrossover (specialized for BitGenotype) and PackedFlipBitMutation
+	 */
+	class BitGenotype
+	{
+	public:
+		using Word		 = uint64_t;
+		using size_type	 = size_t;
+		using value_type = bool;
+
+		static const size_type WORD_BITS = 64;
+
+		/**
+		 *	@brief	Proxy reference to a single bit
+		 */
+		class reference
+		{
+		private:
+			Word* word_;
+			Word  mask_;
+
+		public:
+			reference(Word* word, Word mask) : word_(word), mask_(mask) { }
+
+			operator bool() const { return (*word_ & mask_) != 0; }
+
+			reference& operator=(bool value)
+			{
+				if (value)
+					*word_ |= mask_;
+				else
+					*word_ &= ~mask_;
+
+				return *this;
+			}
+
+			reference& operator=(const reference& other) { return *this = bool(other); }
+
+			void flip() { *word_ ^= mask_; }
+
+			friend void swap(reference a, reference b)
+			{
+				bool value = a;
+				a = bool(b);
+				b = value;
+			}
+		};
+
+	private:
+		std::vector<Word>	words_;
+		size_type			size_;
+
+		static inline size_type wordsFor(size_type bits) { return (bits + WORD_BITS - 1) / WORD_BITS; }
+		static inline Word		maskOf(size_type bit)	 { return Word(1) << (bit % WORD_BITS); }
+
+		/**
+		 *	@brief	Mask of bits [first, last) of a single word, 0 <= first < last <= 64
+		 */
+		static inline Word rangeMask(size_type first, size_type last)
+		{
+			Word high = last == WORD_BITS ? ~Word(0) : (Word(1) << last) - 1;
+			return high & ~((Word(1) << first) - 1);
+		}
+
+		void clearPadding()
+		{
+			if (size_ % WORD_BITS != 0)
+				words_.back() &= rangeMask(0, size_ % WORD_BITS);
+		}
+
+	public:
+		BitGenotype() : size_(0) { }
+		explicit BitGenotype(size_type size, bool value = false) : words_(wordsFor(size), value ? ~Word(0) : 0), size_(size) { clearPadding(); }
+
+		size_type	size() const	  { return size_; }
+		bool		empty() const	  { return size_ == 0; }
+		size_type	wordCount() const { return words_.size(); }
+
+		Word*		data()		 { return words_.data(); }
+		const Word*	data() const { return words_.data(); }
+
+		void resize(size_type size, bool value = false)
+		{
+			size_type old_size = size_;
+
+			words_.resize(wordsFor(size), value ? ~Word(0) : 0);
+			size_ = size;
+
+			//	Bits of previously last word that became part of genotype
+			if (value && old_size < size && old_size % WORD_BITS != 0)
+				words_[old_size / WORD_BITS] |= ~rangeMask(0, old_size % WORD_BITS);
+
+			clearPadding();
+		}
+
+		void reserve(size_type size) { words_.reserve(wordsFor(size)); }
+
+		void clear()
+		{
+			words_.clear();
+			size_ = 0;
+		}
+
+		void push_back(bool value)
+		{
+			if (size_ % WORD_BITS == 0)
+				words_.push_back(0);
+
+			++size_;
+			set(size_ - 1, value);
+		}
+
+		bool		operator[](size_type position) const { return get(position); }
+		reference	operator[](size_type position)		 { return reference(&words_[position / WORD_BITS], maskOf(position)); }
+
+		bool get(size_type position) const { return (words_[position / WORD_BITS] & maskOf(position)) != 0; }
+
+		void set(size_type position, bool value) { (*this)[position] = value; }
+
+		void flip(size_type position) { words_[position / WORD_BITS] ^= maskOf(position); }
+
+		/**
+		 *	@brief	Number of genes equal to true
+		 */
+		size_type count() const
+		{
+			size_type result = 0;
+			for (auto word : words_)
+				result += popcount(word);
+
+			return result;
+		}
+
+		/**
+		 *	@brief	Exchanges genes [first, last) with other genotype of equal size
+		 *
+		 *	@details Whole words are swapped at once, only boundary words are masked
+		 */
+		void swapRange(BitGenotype& other, size_type first, size_type last)
+		{
+			if (first >= last)
+				return;
+
+			size_type first_word = first / WORD_BITS;
+			size_type last_word = (last - 1) / WORD_BITS;
+
+			for (size_type i = first_word; i <= last_word; ++i)
+			{
+				size_type begin = i == first_word ? first % WORD_BITS : 0;
+				size_type end = i == last_word ? (last - 1) % WORD_BITS + 1 : WORD_BITS;
+
+				Word difference = (words_[i] ^ other.words_[i]) & rangeMask(begin, end);
+				words_[i] ^= difference;
+				other.words_[i] ^= difference;
+			}
+		}
+
+		/**
+		 *	@brief	Exchanges genes selected by mask, word by word
+		 *
+		 *	@details Bit j of word i of mask decides about gene i * 64 + j. Masks
+		 *			 are drawn by Generator (called once per word), so that uniform
+		 *			 crossover costs one random number per 64 genes
+		 */
+		template <typename Generator>
+		void swapMasked(BitGenotype& other, Generator&& mask)
+		{
+			for (size_type i = 0; i < words_.size(); ++i)
+			{
+				Word difference = (words_[i] ^ other.words_[i]) & mask();
+				words_[i] ^= difference;
+				other.words_[i] ^= difference;
+			}
+		}
+
+		bool operator==(const BitGenotype& other) const { return size_ == other.size_ && words_ == other.words_; }
+		bool operator!=(const BitGenotype& other) const { return !(*this == other); }
+	};
+
+	/**
+	 *	@brief	Number of genes that differ between two genotypes of equal size
+	 */
+	inline size_t hammingDistance(const BitGenotype& a, const BitGenotype& b)
+	{
+		size_t distance = 0;
+
+		const BitGenotype::Word* words_a = a.data();
+		const BitGenotype::Word* words_b = b.data();
+
+		for (size_t i = 0; i < a.wordCount(); ++i)
+			distance += popcount(words_a[i] ^ words_b[i]);
+
+		return distance;
+	}
+
+}
+
+#endif // !__BIT_GENOTYPE__
@@ -0,0 +1,373 @@
+/**
+ *	Class describing which genes of a Genotype were modified by genetic
+ *	operators since last evaluation. It is used to evaluate fitness
+ *	incrementally - only modified part of Genotype is taken into account
+ *
+ *	Authors: Michal Swiatek, Michal Sulek
+ *	Update:	 17.10.2026
+ *
+ *	Github repository: https://github.com/MichalKonradSulek/ZPR
+ */
+
+#ifndef __CHANGE_SET__
+#define __CHANGE_SET__
+
+#include <array>
+#include <vector>
+#include <cstdint>
+#include <type_traits>
+#include <algorithm>
+
+namespace ga {
+
+	/**
+	 *	@brief	Set of ranges of Genotype modified since last evaluation
+	 *
+	 *	@details Operators call record() before they modify a range of genes,
+	 *			 previous values of genes are stored, so that incremental fitness
+	 *			 can compare old and new state. When recorded ranges grow beyond
+	 *			 half of Genotype, set becomes full - whole Genotype is treated as
+	 *			 modified and no more ranges are stored. Newly created Specimens
+	 *			 have full change sets, environment clears them after evaluation
+	 *			 with DeltaFitness, so changes are recorded only when they are used
+	 *
+	 *	@tparam	GeneType Type of Gene of modified Genotype
+	 *
+	 *	@see	DeltaFitness
+	 */
+	template <typename GeneType>
+	class ChangeSet
+	{
+	public:
+		using Gene		= GeneType;
+		using size_type = size_t;
+
+		/**
+		 *	@brief	Modified genes [first, last), their previous values are stored
+		 *			from position offset
+		 */
+		struct Range
+		{
+			size_type first;
+			size_type last;
+			size_type offset;
+		};
+
+	private:
+		std::vector<Range>	ranges_;
+		std::vector<Gene>	old_genes_;
+
+		mutable std::vector<Range> merged_;
+
+		bool full_;
+
+	public:
+		ChangeSet() : full_(true) { }
+
+		/**
+		 *	@brief	Records range of genes that is about to be modified
+		 *
+		 *	@note	Has to be called before modification, previous values are copied
+		 */
+		template <typename GenotypeType>
+		void record(const GenotypeType& genes, size_type first, size_type last)
+		{
+			if (full_ || first >= last)
+				return;
+
+			if (2 * (old_genes_.size() + last - first) > genes.size())
+			{
+				markAll();
+				return;
+			}
+
+			//	Storage for changes up to the limit is allocated once and reused after clear()
+			if (old_genes_.capacity() == 0)
+				old_genes_.reserve(genes.size() / 2 + 1);
+
+			ranges_.push_back(Range{ first, last, old_genes_.size() });
+			for (size_type i = first; i < last; ++i)
+				old_genes_.push_back(genes[i]);
+		}
+
+		/**
+		 *	@brief	Records single gene that is about to be modified
+		 */
+		template <typename GenotypeType>
+		void record(const GenotypeType& genes, size_type position)
+		{
+			record(genes, position, position + 1);
+		}
+
+		/**
+		 *	@brief	Treats whole Genotype as modified
+		 */
+		void markAll()
+		{
+			full_ = true;
+
+			ranges_.clear();
+			old_genes_.clear();
+		}
+
+		/**
+		 *	@brief	Forgets all changes, called after Specimen is evaluated
+		 */
+		void clear()
+		{
+			full_ = false;
+
+			ranges_.clear();
+			old_genes_.clear();
+		}
+
+		bool isFull() const { return full_; }
+
+		/**
+		 *	@brief	True if Genotype hasn't been modified since last evaluation
+		 */
+		bool isEmpty() const { return !full_ && ranges_.empty(); }
+
+		/**
+		 *	@brief	Recorded ranges in order of recording, they may overlap
+		 */
+		const std::vector<Range>& getRanges() const { return ranges_; }
+
+		/**
+		 *	@brief	Sorted, disjoint and non-adjacent ranges covering all modified genes
+		 *
+		 *	@details Adjacent ranges are merged as well, so that neighbouring pairs of
+		 *			 genes touching different returned ranges never overlap
+		 */
+		const std::vector<Range>& getMergedRanges() const
+		{
+			merged_ = ranges_;
+			std::sort(merged_.begin(), merged_.end(), [](const Range& a, const Range& b) { return a.first < b.first; });
+
+			size_type count = 0;
+			for (const auto& range : merged_)
+			{
+				if (count > 0 && range.first <= merged_[count - 1].last)
+					merged_[count - 1].last = std::max(merged_[count - 1].last, range.last);
+				else
+					merged_[count++] = range;
+			}
+			merged_.resize(count);
+
+			return merged_;
+		}
+
+		/**
+		 *	@brief	Value of gene at given position before recorded modifications
+		 *
+		 *	@param	genes	 Current Genotype
+		 *	@param	position Position of gene
+		 */
+		template <typename GenotypeType>
+		Gene getOldGene(const GenotypeType& genes, size_type position) const
+		{
+			//	First recording of a position holds its value from before all changes
+			for (const auto& range : ranges_)
+			{
+				if (range.first <= position && position < range.last)
+					return old_genes_[range.offset + position - range.first];
+			}
+
+			return genes[position];
+		}
+	};
+
+	/**
+	 *	@brief	Set of ranges of fixed length Genotype modified since last evaluation
+	 *
+	 *	@details Equivalent of ChangeSet stored inline - at most MAX_RANGES ranges
+	 *			 and N / 2 previous values of genes are kept in arrays, more changes
+	 *			 make set full. Positions are stored in 16 bits when N allows it. It is trivially copyable when Gene is, so Specimens
+	 *			 holding it are copied as a block of known size
+	 *
+	 *	@tparam	GeneType Type of Gene of modified Genotype
+	 *	@tparam	N		 Number of Genes of Genotype
+	 *
+	 *	@see	ChangeSet
+	 *	@see	FixedSpecimen
+	 */
+	template <typename GeneType, size_t N>
+	class FixedChangeSet
+	{
+	public:
+		using Gene		= GeneType;
+		using size_type = size_t;
+
+		static constexpr size_type MAX_RANGES = 8;
+
+		using Index = std::conditional_t<(N <= 0xFFFF), std::uint16_t, std::uint32_t>;
+
+		/**
+		 *	@brief	Modified genes [first, last), their previous values are stored
+		 *			from position offset
+		 */
+		struct Range
+		{
+			Index first;
+			Index last;
+			Index offset;
+		};
+
+		/**
+		 *	@brief	Up to MAX_RANGES ranges stored inline
+		 */
+		struct Ranges
+		{
+			std::array<Range, MAX_RANGES>	items;
+			Index							count;
+
+			const Range* begin() const { return items.data(); }
+			const Range* end() const { return items.data() + count; }
+
+			size_type	size() const { return count; }
+			bool		empty() const { return count == 0; }
+
+			const Range& operator[](size_type index) const { return items[index]; }
+		};
+
+	private:
+		Ranges					ranges_;
+		std::array<Gene, N / 2> old_genes_;
+		Index					old_count_;
+
+		bool full_;
+
+	public:
+		FixedChangeSet() : old_count_(0), full_(true) { ranges_.count = 0; }
+
+		/**
+		 *	@brief	Records range of genes that is about to be modified
+		 *
+		 *	@note	Has to be called before modification, previous values are copied
+		 */
+		template <typename GenotypeType>
+		void record(const GenotypeType& genes, size_type first, size_type last)
+		{
+			if (full_ || first >= last)
+				return;
+
+			if (2 * (old_count_ + last - first) > N || ranges_.count == MAX_RANGES)
+			{
+				markAll();
+				return;
+			}
+
+			ranges_.items[ranges_.count++] = Range{ Index(first), Index(last), old_count_ };
+			for (size_type i = first; i < last; ++i)
+				old_genes_[old_count_++] = genes[i];
+		}
+
+		/**
+		 *	@brief	Records single gene that is about to be modified
+		 */
+		template <typename GenotypeType>
+		void record(const GenotypeType& genes, size_type position)
+		{
+			record(genes, position, position + 1);
+		}
+
+		/**
+		 *	@brief	Treats whole Genotype as modified
+		 */
+		void markAll()
+		{
+			full_ = true;
+
+			ranges_.count = 0;
+			old_count_ = 0;
+		}
+
+		/**
+		 *	@brief	Forgets all changes, called after Specimen is evaluated
+		 */
+		void clear()
+		{
+			full_ = false;
+
+			ranges_.count = 0;
+			old_count_ = 0;
+		}
+
+		bool isFull() const { return full_; }
+
+		/**
+		 *	@brief	True if Genotype hasn't been modified since last evaluation
+		 */
+		bool isEmpty() const { return !full_ && ranges_.empty(); }
+
+		/**
+		 *	@brief	Recorded ranges in order of recording, they may overlap
+		 */
+		const Ranges& getRanges() const { return ranges_; }
+
+		/**
+		 *	@brief	Sorted, disjoint and non-adjacent ranges covering all modified genes
+		 *
+		 *	@see	ChangeSet::getMergedRanges
+		 */
+		Ranges getMergedRanges() const
+		{
+			Ranges merged = ranges_;
+			std::sort(merged.items.begin(), merged.items.begin() + merged.count, [](const Range& a, const Range& b) { return a.first < b.first; });
+
+			Index count = 0;
+			for (Index i = 0; i < merged.count; ++i)
+			{
+				const Range range = merged.items[i];
+				if (count > 0 && range.first <= merged.items[count - 1].last)
+					merged.items[count - 1].last = std::max(merged.items[count - 1].last, range.last);
+				else
+					merged.items[count++] = range;
+			}
+			merged.count = count;
+
+			return merged;
+		}
+
+		/**
+		 *	@brief	Value of gene at given position before recorded modifications
+		 *
+		 *	@param	genes	 Current Genotype
+		 *	@param	position Position of gene
+		 */
+		template <typename GenotypeType>
+		Gene getOldGene(const GenotypeType& genes, size_type position) const
+		{
+			for (const auto& range : ranges_)
+			{
+				if (range.first <= position && position < range.last)
+					return old_genes_[range.offset + position - range.first];
+			}
+
+			return genes[position];
+		}
+	};
+
+	template <typename GeneType, size_t N>
+	constexpr typename FixedChangeSet<GeneType, N>::size_type FixedChangeSet<GeneType, N>::MAX_RANGES;
+
+	/**
+	 *	@brief	Type of change set recording modifications of given Genotype
+	 *
+	 *	@details Genotypes stored in std::array use FixedChangeSet, others ChangeSet
+	 */
+	template <typename GeneType, typename GenotypeType>
+	struct ChangeSetOf
+	{
+		using type = ChangeSet<GeneType>;
+	};
+
+	template <typename GeneType, size_t N>
+	struct ChangeSetOf<GeneType, std::array<GeneType, N> >
+	{
+		using type = FixedChangeSet<GeneType, N>;
+	};
+
+}
+
+#endif // !__CHANGE_SET__
@@ -17,6 +17,9 @@
 #include <cstdlib>
 #include <vector>
 
+#include "random.hpp"
+#include "change_set.hpp"
+
 namespace ga {
 
 	/**
@@ -27,20 +30,30 @@ namespace ga {
 	 *			 It is used to mix genetic information contained within parents,
 	 *			 then mutation is applied
 	 *
-	 *	@param	GeneType Type of Gene in Genotype, used to determine DNA type
+	 *	@param	GeneType	 Type of Gene in Genotype, used to determine DNA type
+	 *	@param	GenotypeType Container of Genes, by default std::vector<GeneType>
 	 *
 	 *	@note	cross(Genotype& parent1, Genotype& parent2) must be overriden
+	 *	@note	Random numbers should be drawn from getRandom()
+	 *	@note	Environment crosses pairs concurrently, so cross() has to be thread safe
+	 *			(scratch buffers should be thread_local)
+	 *	@note	Environment crosses trough crossTracked(), which by default calls cross(),
+	 *			predefined crossovers recording changes override it, so classes derived
+	 *			from them and overriding cross() have to override crossTracked() too
 	 *
 	 *	@see	GA::Specimen
 	 *	@see	GA::Mutation
 	 *	@see	GA::Selection
 	 */
-	template <typename GeneType>
+	template <typename GeneType, typename GenotypeType = std::vector<GeneType> >
 	class Crossover
 	{
 	public:
 		using Gene = GeneType;
-		using Genotype = std::vector<Gene>;
+		using Genotype = GenotypeType;
+		using Changes = typename ChangeSetOf<Gene, Genotype>::type;
+
+		virtual ~Crossover() = default;
 
 		/**
 		 *	@brief	Function defining crossover method
@@ -48,6 +61,27 @@ namespace ga {
 		 *	@note	This method has to be overriden
 		 */
 		virtual void cross(Genotype& parent1, Genotype& parent2) = 0;
+
+		/**
+		 *	@brief	Crossover recording modified genes in change sets of both parents
+		 *
+		 *	@details By default calls cross() and marks both Genotypes as modified,
+		 *			 so overriden cross() is always used. Override it to allow
+		 *			 incremental evaluation of offspring
+		 *
+		 *	@return	True if Genotypes could have been modified
+		 *
+		 *	@see	DeltaFitness
+		 */
+		virtual bool crossTracked(Genotype& parent1, Genotype& parent2, Changes& changes1, Changes& changes2)
+		{
+			cross(parent1, parent2);
+
+			changes1.markAll();
+			changes2.markAll();
+
+			return true;
+		}
 	};
 
 }
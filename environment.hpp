@@ -3,6 +3,8 @@
  *  environment settings one function performs whole algorithm with
  *  specified loop (generation happens only once at the beginning):
  *      generate -> evaluate -> selection -> genetic_operators -> succession
+ *  Optionally population buffers can be recycled between generations, so
+ *  that steady-state evolution doesn't allocate memory
  *
  *  Authors: Michal Swiatek, Michal Sulek
  *	Update:	 19.01.2020
@@ -16,23 +18,54 @@
 #include <vector>
 #include <algorithm>
 #include <memory>
+#include <atomic>
+#include <functional>
+#include <type_traits>
 
 #include "specimen.hpp"
+#include "fitness.hpp"
+#include "fitness_cache.hpp"
 
 #include "mutation.hpp"
 #include "crossover.hpp"
 #include "selection.hpp"
+#include "succession.hpp"
+#include "local_search.hpp"
 
 #include "Predefined/mutations.hpp"
 #include "Predefined/crossovers.hpp"
 #include "Predefined/selections.hpp"
+#include "Predefined/successions.hpp"
+#include "Predefined/local_searches.hpp"
 
 #include "Predefined/ga_utility.hpp"
 
+#include "random.hpp"
+#include "executor.hpp"
 #include "exception.hpp"
+#include "instrumentation.hpp"
+#include "generation_stats.hpp"
 
 namespace ga {
 
+	/**
+	 *	@brief	Instantiates genetic operator template for given Gene and Genotype
+	 *
+	 *	@details Operators of genes stored in std::vector are instantiated with
+	 *			 Gene only, so that user templates with single parameter work
+	 */
+	template <template <typename...> class OperatorType, typename GeneType, typename GenotypeType>
+	struct BindOperator
+	{
+		using type = OperatorType<GeneType, GenotypeType>;
+	};
+
+	template <template <typename...> class OperatorType, typename GeneType>
+	struct BindOperator<OperatorType, GeneType, std::vector<GeneType> >
+	{
+		using type = OperatorType<GeneType>;
+	};
+
 	/**
 	 *	@brief	An environment defining population and specified genetic operators
 	 *
@@ -46,6 +79,7 @@ namespace ga {
 	 *	@see	Mutation
 	 *	@see	Crossover
 	 *	@see	Selection
+	 *	@see	Executor
 	 */
 	template <typename SpecimenType>
 	class Environment
@@ -55,10 +89,12 @@ namespace ga {
 
 		using Gene			= typename SpecimenType::Gene;
 		using Chromosome	= typename SpecimenType::Chromosome;
-		using Genotype		= std::vector<Gene>;
-		using Fenotype		= std::vector<Chromosome>;
+		using Genotype		= typename SpecimenType::Genotype;
+		using Fenotype		= typename SpecimenType::Fenotype;
+		using Changes		= typename ChangeSetOf<Gene, Genotype>::type;
 
 		using Population	= std::vector<SpecimenType>;
+		using Indices		= typename Selection<SpecimenType>::Indices;
 
 	protected:
 		Population population_;
@@ -66,121 +102,586 @@ namespace ga {
 		Population mating_pool_;
 		Population offspring_;
 
-		std::unique_ptr<Mutation<Gene>>				mutation_type_;
-		std::unique_ptr<Crossover<Gene>>			crossover_type_;
+		Indices parent_indices_;
+
+		bool recycle_buffers_ = false;
+
+		//	Number of offspring per generation, 0 means size of population
+		size_type offspring_size_ = 0;
+
+		//	Evaluation of unmodified members is skipped, others are looked up in cache
+		bool										memoization_ = false;
+		std::unique_ptr<FitnessCache<Genotype>>		evaluation_cache_;
+		EvaluationStatistics						evaluation_statistics_;
+
+		Indices					pending_;
+		std::vector<uint64_t>	pending_hashes_;
+
+		//	Fitness of population_ in one array (structure of arrays), valid together with stats_
+		std::vector<double>		fitness_column_;
+		//	Output of batch evaluation, indexed like evaluated population
+		std::vector<double>		batch_fitness_;
+
+		std::unique_ptr<Mutation<Gene, Genotype>>	mutation_type_;
+		std::unique_ptr<Crossover<Gene, Genotype>>	crossover_type_;
 		std::unique_ptr<Selection<SpecimenType>>	selection_type_;
+		std::unique_ptr<Succession<SpecimenType>>	succession_type_;
+
+		//	Optional memetic stage, applied to given fraction of offspring
+		std::unique_ptr<LocalSearch<Gene, Genotype>>	local_search_type_;
+		double											local_search_rate_ = 1.0;
+		Indices											local_search_indices_;
+
+		std::unique_ptr<Executor>					executor_;
+
+		Random random_;
+
+		Instrumentation		instrumentation_;
+		GenerationRecord*	current_record_ = nullptr;
+
+		//	Statistics of current population, valid after its evaluation
+		GenerationStats		stats_;
+		bool				stats_valid_ = false;
+
+		/**
+		 *	@brief	Adds value to counter of currently recorded generation
+		 */
+		void recordCount(uint64_t GenerationRecord::* counter, uint64_t value)
+		{
+			if (current_record_ != nullptr)
+				current_record_->*counter += value;
+		}
 
 	private:
 		void setDefaults()
 		{
-			mutation_type_ = std::make_unique<SwapGeneMutation<Gene> >();
-			crossover_type_ = std::make_unique<SinglePointCrossover<Gene> >();
+			mutation_type_ = std::make_unique<SwapGeneMutation<Gene, Genotype> >();
+			crossover_type_ = std::make_unique<SinglePointCrossover<Gene, Genotype> >();
 			selection_type_ = std::make_unique<RouletteWheelSelection<SpecimenType> >();
+
+			setDefaultExecutor();
+		}
+
+		void setDefaultExecutor()
+		{
+			executor_ = std::make_unique<SequentialExecutor>();
 		}
 
 	public:
-		explicit Environment(size_type population_size = 0)
+		explicit Environment(size_type population_size = 0) : random_(ga::getRandom()())
 		{
+			RandomBinding binding(random_);
 			generatePopulation(population_size);
 
 			setDefaults();
 		}
 
-		explicit Environment(const Population& population) : population_(population) { setDefaults(); }
-		explicit Environment(Population&& population) :		 population_(population) { setDefaults(); }
+		explicit Environment(const Population& population) : population_(population), random_(ga::getRandom()()) { setDefaults(); }
+		explicit Environment(Population&& population) :		 population_(std::move(population)), random_(ga::getRandom()()) { setDefaults(); }
 
 		explicit Environment(size_type					population_size,
-							 Mutation<Gene>*			mutation_ptr,
-							 Crossover<Gene>*			crossover_ptr,
-							 Selection<SpecimenType>*	selection_ptr)
+							 Mutation<Gene, Genotype>*	mutation_ptr,
+							 Crossover<Gene, Genotype>*	crossover_ptr,
+							 Selection<SpecimenType>*	selection_ptr) : random_(ga::getRandom()())
 		{
+			RandomBinding binding(random_);
 			generatePopulation(population_size);
 
-			mutation_type_ = std::unique_ptr<Mutation<Gene> >(mutation_ptr);
-			crossover_type_ = std::unique_ptr<Crossover<Gene> >(crossover_ptr);
+			mutation_type_ = std::unique_ptr<Mutation<Gene, Genotype> >(mutation_ptr);
+			crossover_type_ = std::unique_ptr<Crossover<Gene, Genotype> >(crossover_ptr);
 			selection_type_ = std::unique_ptr<Selection<SpecimenType> >(selection_ptr);
+
+			setDefaultExecutor();
 		}
 
 		explicit Environment(const Population& population,
-			Mutation<Gene>*			mutation_ptr,
-			Crossover<Gene>*			crossover_ptr,
-			Selection<SpecimenType>*	selection_ptr) : population_(population)
+			Mutation<Gene, Genotype>*	mutation_ptr,
+			Crossover<Gene, Genotype>*	crossover_ptr,
+			Selection<SpecimenType>*	selection_ptr) : population_(population), random_(ga::getRandom()())
 		{
-			mutation_type_ = std::unique_ptr<Mutation<Gene> >(mutation_ptr);
-			crossover_type_ = std::unique_ptr<Crossover<Gene> >(crossover_ptr);
+			mutation_type_ = std::unique_ptr<Mutation<Gene, Genotype> >(mutation_ptr);
+			crossover_type_ = std::unique_ptr<Crossover<Gene, Genotype> >(crossover_ptr);
 			selection_type_ = std::unique_ptr<Selection<SpecimenType> >(selection_ptr);
+
+			setDefaultExecutor();
 		}
 
 		explicit Environment(Population&& population,
-							 Mutation<Gene>*			mutation_ptr,
-							 Crossover<Gene>*			crossover_ptr,
-							 Selection<SpecimenType>*	selection_ptr) : population_(population)
+							 Mutation<Gene, Genotype>*	mutation_ptr,
+							 Crossover<Gene, Genotype>*	crossover_ptr,
+							 Selection<SpecimenType>*	selection_ptr) : population_(std::move(population)), random_(ga::getRandom()())
 		{
-			mutation_type_ = std::unique_ptr<Mutation<Gene> >(mutation_ptr);
-			crossover_type_ = std::unique_ptr<Crossover<Gene> >(crossover_ptr);
+			mutation_type_ = std::unique_ptr<Mutation<Gene, Genotype> >(mutation_ptr);
+			crossover_type_ = std::unique_ptr<Crossover<Gene, Genotype> >(crossover_ptr);
 			selection_type_ = std::unique_ptr<Selection<SpecimenType> >(selection_ptr);
+
+			setDefaultExecutor();
 		}
 
 	protected:
 		template <typename FitnessFunction>
-		void evaluation(FitnessFunction fitness)
+		void evaluation(FitnessFunction& fitness, Executor& executor)
+		{
+			evaluation(population_, fitness, executor);
+			updateStatistics();
+		}
+
+		/**
+		 *	@brief	Gathers fitness column of evaluated population_ and computes its GenerationStats
+		 */
+		void updateStatistics()
+		{
+			fitness_column_.resize(population_.size());
+			for (size_type i = 0; i < population_.size(); ++i)
+				fitness_column_[i] = population_[i].getFitness();
+
+			stats_.compute(fitness_column_.data(), fitness_column_.size());
+			stats_valid_ = true;
+		}
+
+		/**
+		 *	@brief	Evaluates every member of given population using given executor
+		 *
+		 *	@details Members are evaluated independently, so with parallel executor
+		 *			 FitnessFunction is called concurrently and has to be thread safe.
+		 *			 FitnessFunction derived from DeltaFitness evaluates members with
+		 *			 recorded changes incrementally, change sets are cleared afterwards.
+		 *			 With evaluation cache enabled only modified members missing from
+		 *			 cache are evaluated. FitnessFunction derived from BatchFitness
+		 *			 receives whole chunks of population (or runs of consecutive
+		 *			 members to evaluate) in one call
+		 */
+		template <typename FitnessFunction>
+		void evaluation(Population& population, FitnessFunction& fitness, Executor& executor)
 		{
-			for (auto& member : population_)
-				member.setFitness(fitness(member));
+			using IsBatch = std::is_base_of<BatchFitness<SpecimenType>, FitnessFunction>;
+			using IsDelta = std::integral_constant<bool, std::is_base_of<DeltaFitness<SpecimenType>, FitnessFunction>::value && !IsBatch::value>;
+
+			if (memoization_)
+			{
+				memoizedEvaluation(population, fitness, executor, IsDelta(), IsBatch());
+				return;
+			}
+
+			recordCount(&GenerationRecord::evaluations, population.size());
+
+			evaluateAll(population, fitness, executor, IsDelta(), IsBatch());
+		}
+
+		template <typename FitnessFunction, typename IsDelta>
+		void evaluateAll(Population& population, FitnessFunction& fitness, Executor& executor, IsDelta, std::false_type)
+		{
+			executor.parallelFor(0, population.size(), [&population, &fitness](size_type begin, size_type end)
+			{
+				for (size_type i = begin; i < end; ++i)
+					finishEvaluation(population[i], evaluateMember(fitness, population[i], IsDelta()), IsDelta());
+			});
+		}
+
+		template <typename FitnessFunction, typename IsDelta>
+		void evaluateAll(Population& population, FitnessFunction& fitness, Executor& executor, IsDelta, std::true_type)
+		{
+			batch_fitness_.resize(population.size());
+			auto body = [this, &population, &fitness](size_type begin, size_type end)
+			{
+				fitness.evaluateBatch(population.data() + begin, end - begin, batch_fitness_.data() + begin);
+
+				for (size_type i = begin; i < end; ++i)
+					finishEvaluation(population[i], batch_fitness_[i], std::false_type());
+			};
+			executor.parallelFor(0, population.size(), std::cref(body));
+		}
+
+		//	Evaluates members of population listed in pending_
+		template <typename FitnessFunction, typename IsDelta>
+		void evaluatePending(Population& population, FitnessFunction& fitness, Executor& executor, IsDelta is_delta, std::false_type)
+		{
+			auto body = [this, &population, &fitness, is_delta](size_type begin, size_type end)
+			{
+				for (size_type i = begin; i < end; ++i)
+				{
+					SpecimenType& member = population[pending_[i]];
+					finishEvaluation(member, evaluateMember(fitness, member, is_delta), is_delta);
+				}
+			};
+			executor.parallelFor(0, pending_.size(), std::cref(body));
+		}
+
+		template <typename FitnessFunction, typename IsDelta>
+		void evaluatePending(Population& population, FitnessFunction& fitness, Executor& executor, IsDelta, std::true_type)
+		{
+			batch_fitness_.resize(population.size());
+			auto body = [this, &population, &fitness](size_type begin, size_type end)
+			{
+				//	Pending indices are sorted, every run of consecutive members is one batch
+				for (size_type first = begin, last; first < end; first = last)
+				{
+					for (last = first + 1; last < end && pending_[last] == pending_[last - 1] + 1; ++last);
+
+					fitness.evaluateBatch(population.data() + pending_[first], last - first, batch_fitness_.data() + pending_[first]);
+
+					for (size_type i = first; i < last; ++i)
+						finishEvaluation(population[pending_[i]], batch_fitness_[pending_[i]], std::false_type());
+				}
+			};
+			executor.parallelFor(0, pending_.size(), std::cref(body));
+		}
+
+		/**
+		 *	@brief	Evaluation skipping unmodified members and members found in cache
+		 *
+		 *	@details Hashes and fitness of remaining members are computed in parallel,
+		 *			 cache is accessed only from calling thread
+		 */
+		template <typename FitnessFunction, typename IsDelta, typename IsBatch>
+		void memoizedEvaluation(Population& population, FitnessFunction& fitness, Executor& executor, IsDelta is_delta, IsBatch is_batch)
+		{
+			pending_.clear();
+			for (size_type i = 0; i < population.size(); ++i)
+			{
+				if (population[i].isModified())
+					pending_.push_back(i);
+			}
+
+			evaluation_statistics_.skipped += population.size() - pending_.size();
+			recordCount(&GenerationRecord::skipped, population.size() - pending_.size());
+
+			if (evaluation_cache_)
+			{
+				pending_hashes_.resize(pending_.size());
+				executor.parallelFor(0, pending_.size(), [this, &population](size_type begin, size_type end)
+				{
+					for (size_type i = begin; i < end; ++i)
+						pending_hashes_[i] = evaluation_cache_->hash(memberGenotype(population, pending_[i]));
+				});
+
+				size_type missing = 0;
+				for (size_type i = 0; i < pending_.size(); ++i)
+				{
+					double cached_fitness;
+					if (evaluation_cache_->find(memberGenotype(population, pending_[i]), pending_hashes_[i], cached_fitness))
+					{
+						finishEvaluation(population[pending_[i]], cached_fitness, is_delta);
+						++evaluation_statistics_.hits;
+					}
+					else
+					{
+						pending_[missing] = pending_[i];
+						pending_hashes_[missing] = pending_hashes_[i];
+						++missing;
+					}
+				}
+
+				recordCount(&GenerationRecord::cache_hits, pending_.size() - missing);
+
+				pending_.resize(missing);
+				pending_hashes_.resize(missing);
+			}
+
+			evaluation_statistics_.misses += pending_.size();
+			recordCount(&GenerationRecord::evaluations, pending_.size());
+
+			evaluatePending(population, fitness, executor, is_delta, is_batch);
+
+			if (evaluation_cache_)
+			{
+				for (size_type i = 0; i < pending_.size(); ++i)
+					evaluation_cache_->insert(memberGenotype(population, pending_[i]), pending_hashes_[i], population[pending_[i]].getFitness());
+			}
+		}
+
+		//	Read only access, doesn't mark member as modified
+		static const Genotype& memberGenotype(const Population& population, size_type index)
+		{
+			return population[index].getGenotype();
+		}
+
+		template <typename FitnessFunction>
+		static double evaluateMember(FitnessFunction& fitness, SpecimenType& member, std::false_type)
+		{
+			return fitness(member);
+		}
+
+		template <typename FitnessFunction>
+		static double evaluateMember(FitnessFunction& fitness, SpecimenType& member, std::true_type)
+		{
+			double result;
+			if (member.getChanges().isFull() || !fitness.evaluateDelta(member, member.getFitness(), member.getChanges(), result))
+				result = fitness(member);
+
+			return result;
+		}
+
+		//	Without DeltaFitness change sets are left full, so operators don't record changes nobody reads
+		static void finishEvaluation(SpecimenType& member, double fitness, std::false_type)
+		{
+			member.setFitness(fitness);
+			member.getChanges().markAll();
+			member.markEvaluated();
+		}
+
+		static void finishEvaluation(SpecimenType& member, double fitness, std::true_type)
+		{
+			member.setFitness(fitness);
+			member.getChanges().clear();
+			member.markEvaluated();
 		}
 
 		/**
 		 *	@brief  Selection routine, can be overriden to change selection behaviour
 		 *	
-		 *	@details By default this function performs selection of population based on selection_type_
+		 *	@details By default this function performs selection of population based on selection_type_.
+		 *			 When selection_type_ is an IndexSelection, it receives fitness column of population,
+		 *			 indices of parents are stored in parent_indices_ and every parent is copied directly
+		 *			 into mating_pool_.
+		 *			 With buffer recycling enabled parents are copied into offspring_ instead,
+		 *			 reusing memory of specimens from previous generation
 		 *
-		 *	@note	This function has to generate and assign new mating_pool_
+		 *	@note	This function has to generate and assign new mating_pool_ (or offspring_
+		 *			when buffers are recycled)
 		 *	@note	During this function call current population_ is already evaluated
 		 */
 		virtual void selection()
 		{
-			mating_pool_ = selection_type_->select(population_, population_.size());
+			auto index_selection = dynamic_cast<IndexSelection<SpecimenType>*>(selection_type_.get());
+			Population& mating_pool = recycle_buffers_ ? offspring_ : mating_pool_;
+
+			if (index_selection == nullptr)
+			{
+				mating_pool = selection_type_->select(population_, getOffspringSize());
+				return;
+			}
+
+			if (!stats_valid_)
+				updateStatistics();
+
+			index_selection->selectByFitness(population_, fitness_column_.data(), getOffspringSize(), parent_indices_);
+			copyParents();
+		}
+
+		/**
+		 *	@brief	Copies members of population_ picked in parent_indices_ into mating pool
+		 */
+		void copyParents()
+		{
+			Population& mating_pool = recycle_buffers_ ? offspring_ : mating_pool_;
+
+			if (recycle_buffers_ && offspring_.size() == parent_indices_.size())
+			{
+				//	Copy assignment reuses Genotype storage of previous generation
+				for (size_type i = 0; i < parent_indices_.size(); ++i)
+					offspring_[i] = population_[parent_indices_[i]];
+
+				return;
+			}
+
+			mating_pool.clear();
+			mating_pool.reserve(parent_indices_.size());
+
+			for (auto index : parent_indices_)
+				mating_pool.emplace_back(population_[index]);
 		}
 
 		/**
 		 *	@brief	Crossover routine, can be overriden to change crossover behavior
 		 *
 		 *	@details By default it crosses adjacent members (they are randomly placed by selection)
-		 *			 using crossover_type_
+		 *			 using crossover_type_, modified genes are recorded in change sets of members.
+		 *			 Pairs are crossed concurrently using given executor
+		 *
+		 *	@note	This function has to assign new offspring_ (with buffer recycling enabled
+		 *			mating pool is already placed in offspring_ and is crossed in place)
+		 */
+		virtual void crossover(Executor& executor)
+		{
+			crossMatingPool(executor, [this](Genotype& parentA, Genotype& parentB, Changes& changesA, Changes& changesB)
+			{
+				return crossover_type_->crossTracked(parentA, parentB, changesA, changesB);
+			});
+		}
+
+		/**
+		 *	@brief	Crosses adjacent members of mating pool with given function and moves it to offspring_
 		 *
-		 *	@note	This function has to assign new offspring_
+		 *	@details Pairs are processed concurrently, every pair draws random numbers from
+		 *			 its own stream (see stageStreams()), so offspring doesn't depend on
+		 *			 number of threads of executor
+		 *
+		 *	@tparam	CrossFunction Functor with signature of Crossover::crossTracked()
 		 */
-		virtual void crossover()
+		template <typename CrossFunction>
+		void crossMatingPool(Executor& executor, CrossFunction cross)
 		{
-			for (size_t i = 0; i < mating_pool_.size() - 1; i += 2)
-				crossover_type_->cross(mating_pool_[i].getGenotype(), mating_pool_[i + 1].getGenotype());
+			Population& mating_pool = recycle_buffers_ ? offspring_ : mating_pool_;
+
+			RandomStreams streams = stageStreams();
+
+			std::atomic<uint64_t> crossovers(0);
+			//	Body is passed by reference, its captures don't fit small buffer of std::function
+			//	and copying it into Executor::Task would allocate every generation
+			auto body = [&mating_pool, &cross, &crossovers, streams](size_type begin, size_type end)
+			{
+				Random random;
+				RandomBinding binding(random);
+
+				uint64_t crossed = 0;
+				for (size_type pair = begin; pair < end; ++pair)
+				{
+					streams.seed(random, pair);
 
-			offspring_ = std::move(mating_pool_);
+					SpecimenType& parentA = mating_pool[2 * pair];
+					SpecimenType& parentB = mating_pool[2 * pair + 1];
+
+					if (cross(parentA.getTrackedGenotype(), parentB.getTrackedGenotype(), parentA.getChanges(), parentB.getChanges()))
+					{
+						parentA.markModified();
+						parentB.markModified();
+						++crossed;
+					}
+				}
+
+				crossovers.fetch_add(crossed, std::memory_order_relaxed);
+			};
+			executor.parallelFor(0, mating_pool.size() / 2, std::cref(body));
+
+			recordCount(&GenerationRecord::crossovers, crossovers.load());
+
+			if (!recycle_buffers_)
+				offspring_ = std::move(mating_pool_);
 		}
 
 		/**
 		 *	@brief	Mutation routine, can be overriden to change mutation behaviour
 		 *
-		 *	@details By default it mutates every indivudual using mutation_type_
+		 *	@details By default it mutates every indivudual using mutation_type_,
+		 *			 members are mutated concurrently using given executor
 		 *
 		 *	@note	Mutation should be performed on offspring_
 		 */
-		virtual void mutation()
+		virtual void mutation(Executor& executor)
+		{
+			mutateOffspring(executor, [this](Genotype& genes, Changes& changes)
+			{
+				return mutation_type_->mutateTracked(genes, changes);
+			});
+		}
+
+		/**
+		 *	@brief	Mutates every member of offspring_ with given function
+		 *
+		 *	@details Members are processed concurrently, each with its own random stream
+		 *
+		 *	@tparam	MutateFunction Functor with signature of Mutation::mutateTracked()
+		 */
+		template <typename MutateFunction>
+		void mutateOffspring(Executor& executor, MutateFunction mutate)
+		{
+			RandomStreams streams = stageStreams();
+
+			std::atomic<uint64_t> mutations(0);
+			auto body = [this, &mutate, &mutations, streams](size_type begin, size_type end)
+			{
+				Random random;
+				RandomBinding binding(random);
+
+				uint64_t mutated = 0;
+				for (size_type i = begin; i < end; ++i)
+				{
+					streams.seed(random, i);
+
+					SpecimenType& individual = offspring_[i];
+					if (mutate(individual.getTrackedGenotype(), individual.getChanges()))
+					{
+						individual.markModified();
+						++mutated;
+					}
+				}
+
+				mutations.fetch_add(mutated, std::memory_order_relaxed);
+			};
+			executor.parallelFor(0, offspring_.size(), std::cref(body));
+
+			recordCount(&GenerationRecord::mutations, mutations.load());
+		}
+
+		/**
+		 *	@brief	Random streams of work items of one parallel stage
+		 *
+		 *	@details Seed is drawn from generator of environment on calling thread, so
+		 *			 streams depend only on seed of environment, number of previous
+		 *			 draws and current generation
+		 */
+		RandomStreams stageStreams()
 		{
-			for (auto& individual : offspring_)
-				mutation_type_->mutate(individual.getGenotype());
+			return RandomStreams(ga::getRandom()(), stats_.generation);
+		}
+
+		/**
+		 *	@brief	Local search routine, can be overriden to change memetic stage behaviour
+		 *
+		 *	@details When local_search_type_ is set, members of offspring_ are picked with
+		 *			 probability of local search rate (on calling thread, so evolution stays
+		 *			 reproducible) and improved concurrently using given executor
+		 *
+		 *	@note	Local search should be performed on offspring_
+		 */
+		virtual void localSearch(Executor& executor)
+		{
+			if (!local_search_type_)
+				return;
+
+			local_search_indices_.clear();
+			for (size_type i = 0; i < offspring_.size(); ++i)
+			{
+				if (local_search_rate_ >= 1.0 || getRandom().chance(local_search_rate_))
+					local_search_indices_.push_back(i);
+			}
+
+			RandomStreams streams = stageStreams();
+
+			std::atomic<uint64_t> improvements(0);
+			auto body = [this, &improvements, streams](size_type begin, size_type end)
+			{
+				Random random;
+				RandomBinding binding(random);
+
+				for (size_type i = begin; i < end; ++i)
+				{
+					streams.seed(random, i);
+
+					SpecimenType& member = offspring_[local_search_indices_[i]];
+
+					if (local_search_type_->improveTracked(member.getTrackedGenotype(), member.getChanges()))
+					{
+						member.markModified();
+						improvements.fetch_add(1, std::memory_order_relaxed);
+					}
+				}
+			};
+			executor.parallelFor(0, local_search_indices_.size(), std::cref(body));
+
+			recordCount(&GenerationRecord::local_searches, local_search_indices_.size());
+			recordCount(&GenerationRecord::improvements, improvements.load());
 		}
 
 		/**
 		 *	@brief	Reproduction routine, can be overriden to change reproduction behavior
 		 *
-		 *	@details By default it moves an offspring_ into population_
+		 *	@details By default it moves an offspring_ into population_, with buffer recycling
+		 *			 enabled buffers are swapped and previous generation is kept in offspring_
+		 *			 to be overwritten by next one. When succession strategy is set, evaluated
+		 *			 offspring_ and population_ are passed to it instead
 		 *
 		 *	@note	This function has to assign new population_
 		 */
 		virtual void reproduction()
 		{
-			population_ = std::move(offspring_);
+			if (succession_type_)
+				succession_type_->succeed(population_, offspring_);
+			else if (recycle_buffers_)
+				population_.swap(offspring_);
+			else
+				population_ = std::move(offspring_);
 		}
 
 	public:
@@ -195,15 +696,72 @@ namespace ga {
 		 *	@param	show_best			 Calls print() on best individual of generation
 		 */
 		template <typename FitnessFunction>
-		void iteration(FitnessFunction fitness, bool show_best = true) {
-			selection();
+		void iteration(FitnessFunction fitness, bool show_best = true)
+		{
+			iteration(*executor_, fitness, show_best);
+		}
+
+		/**
+		 *	@brief	Evolve by one generation evaluating population with given executor
+		 *
+		 *	@details Overrides executor set in environment for this call only
+		 *
+		 *	@see	iteration(FitnessFunction fitness, bool show_best)
+		 */
+		template <typename FitnessFunction>
+		void iteration(Executor& executor, FitnessFunction fitness, bool show_best = true)
+		{
+			RandomBinding binding(random_);
+
+			using PhaseTimer = Instrumentation::PhaseTimer;
+			//	Timers get local copy of record, so they are optimized out when instrumentation is compiled out
+			GenerationRecord* record = instrumentation_.beginGeneration();
+			current_record_ = record;
+
+			{
+				PhaseTimer total(record, &GenerationRecord::total_ns);
+
+				{
+					PhaseTimer timer(record, &GenerationRecord::selection_ns);
+					selection();
+				}
+				{
+					PhaseTimer timer(record, &GenerationRecord::crossover_ns);
+					crossover(executor);
+				}
+				{
+					PhaseTimer timer(record, &GenerationRecord::mutation_ns);
+					mutation(executor);
+				}
+				if (local_search_type_)
+				{
+					PhaseTimer timer(record, &GenerationRecord::local_search_ns);
+					localSearch(executor);
+				}
 
-			crossover();
-			mutation();
+				//	Succession needs fitness of offspring, otherwise new population is evaluated
+				Population& evaluated = succession_type_ ? offspring_ : population_;
+				if (succession_type_)
+				{
+					PhaseTimer timer(record, &GenerationRecord::evaluation_ns);
+					evaluation(evaluated, fitness, executor);
+				}
+				{
+					PhaseTimer timer(record, &GenerationRecord::reproduction_ns);
+					reproduction();
+				}
+				if (!succession_type_)
+				{
+					PhaseTimer timer(record, &GenerationRecord::evaluation_ns);
+					evaluation(evaluated, fitness, executor);
+				}
 
-			reproduction();
+				++stats_.generation;
+				updateStatistics();
+			}
 
-			evaluation(fitness);
+			instrumentation_.endGeneration(record);
+			current_record_ = nullptr;
 
 			if (show_best)
 				getBest().print();
@@ -217,8 +775,9 @@ namespace ga {
 		 *
 		 *	@tparam FitnessFunction	Functor object taking SpecimenType as an argument and returning
 		 *			it's fitness value converted to double
-		 *	@tparam	FinishCondition	Functor object taking const Population& and FitnessFunction
-		 *			and returning a boolean indicator whether a finish condition is met
+		 *	@tparam	FinishCondition	Functor object taking const Population& and optionally
+		 *			const GenerationStats& and returning a boolean indicator whether a finish
+		 *			condition is met
 		 *
 		 *	@param	number_of_iterations Specifies a number of generations steps, set to -1 to
 		 *			perform evolution until FinishCondition is met
@@ -227,52 +786,270 @@ namespace ga {
 		template <typename FitnessFunction, typename FinishCondition>
 		void runSimulation(FitnessFunction fitness, FinishCondition finishCondition, int number_of_iterations = -1, bool show_best = true)
 		{
+			runSimulation(*executor_, fitness, finishCondition, number_of_iterations, show_best);
+		}
+
+		/**
+		 *	@brief	Perform evolution evaluating population with given executor
+		 *
+		 *	@details Overrides executor set in environment for this call only
+		 *
+		 *	@see	runSimulation(FitnessFunction fitness, FinishCondition finishCondition, int number_of_iterations, bool show_best)
+		 */
+		template <typename FitnessFunction, typename FinishCondition>
+		void runSimulation(Executor& executor, FitnessFunction fitness, FinishCondition finishCondition, int number_of_iterations = -1, bool show_best = true)
+		{
+			RandomBinding binding(random_);
+
 			if (population_.empty())
 				generatePopulation(population_.size());
 			
-			evaluation(fitness);
+			evaluation(fitness, executor);
 
 			if (number_of_iterations == -1)
 			{
-				while (!finishCondition(population_))
-					iteration(fitness, show_best);
+				while (!checkFinish(finishCondition, population_, stats_))
+					iteration(executor, fitness, show_best);
 			}
 			else
 			{
-				while (!finishCondition(population_) && --number_of_iterations >= 0)
-					iteration(fitness, show_best);
+				while (!checkFinish(finishCondition, population_, stats_) && --number_of_iterations >= 0)
+					iteration(executor, fitness, show_best);
 			}
 		}
 
+		/**
+		 *	@brief	Evaluates current population without evolving it
+		 *
+		 *	@details Used when generations are driven manually with iteration(), first
+		 *			 generation has to be evaluated before first call
+		 */
+		template <typename FitnessFunction>
+		void evaluate(FitnessFunction fitness)
+		{
+			RandomBinding binding(random_);
+
+			evaluation(fitness, *executor_);
+		}
+
+		/**
+		 *	@brief	Best member of population
+		 *
+		 *	@details Taken from statistics of last evaluation, population is scanned
+		 *			 only if it changed since then
+		 */
 		SpecimenType& getBest()
 		{
+			if (stats_valid_)
+				return population_[stats_.best_index];
+
 			SpecimenComp<SpecimenType> comp;
 
 			auto it = std::max_element(population_.begin(), population_.end(), comp);
 			return *it;
 		}
 
+		/**
+		 *	@brief	Copies given number of best individuals of population
+		 *
+		 *	@details Best individuals are found with partial ordering of indices,
+		 *			 returned individuals are not sorted
+		 */
+		Population getBestSpecimens(size_type count) const
+		{
+			count = std::min(count, population_.size());
+
+			Indices order(population_.size());
+			for (size_type i = 0; i < order.size(); ++i)
+				order[i] = i;
+
+			auto fitter = [this](size_type a, size_type b) { return population_[a].getFitness() > population_[b].getFitness(); };
+			if (count > 0 && count < order.size())
+				std::nth_element(order.begin(), order.begin() + (count - 1), order.end(), fitter);
+
+			Population best;
+			best.reserve(count);
+			for (size_type i = 0; i < count; ++i)
+				best.push_back(population_[order[i]]);
+
+			return best;
+		}
+
+		/**
+		 *	@brief	Replaces worst individuals of population with given migrants
+		 *
+		 *	@details Migrants keep their fitness, so they should be evaluated with
+		 *			 the same fitness function as current population
+		 */
+		void acceptMigrants(const Population& migrants)
+		{
+			size_type count = std::min(migrants.size(), population_.size());
+			if (count == 0)
+				return;
+
+			Indices order(population_.size());
+			for (size_type i = 0; i < order.size(); ++i)
+				order[i] = i;
+
+			auto weaker = [this](size_type a, size_type b) { return population_[a].getFitness() < population_[b].getFitness(); };
+			if (count < order.size())
+				std::nth_element(order.begin(), order.begin() + (count - 1), order.end(), weaker);
+
+			for (size_type i = 0; i < count; ++i)
+				population_[order[i]] = migrants[i];
+
+			updateStatistics();
+		}
+
 		/**
 		 *	@brief	Generates new population and replaces currently held one
 		 */
 		virtual void generatePopulation(size_t population_size)
 		{
+			RandomBinding binding(random_);
+
 			population_.clear();
 			population_.reserve(population_size);
 
+			stats_ = GenerationStats();
+			stats_valid_ = false;
+
 			for (size_type i = 0; i < population_size; ++i)
 				population_.emplace_back(SpecimenType());
 		}
 
+		/**
+		 *	@brief	Enables recycling of population buffers between generations
+		 *
+		 *	@details Environment keeps two populations: current one and the previous
+		 *			 generation. Selected parents are copy assigned over specimens of
+		 *			 previous generation, so their Genotype storage is reused, and after
+		 *			 genetic operators buffers are swapped. After first few generations
+		 *			 no memory is allocated as long as selection and genetic operators
+		 *			 don't allocate themselves (all predefined strategies don't)
+		 *
+		 *	@note	Overriden selection(), crossover() and reproduction() have to take
+		 *			into account that mating pool is placed in offspring_ in this mode
+		 */
+		void setBufferRecycling(bool recycle_buffers)
+		{
+			recycle_buffers_ = recycle_buffers;
+
+			if (!recycle_buffers_)
+				offspring_.clear();
+		}
+
+		bool isBufferRecycling() const
+		{
+			return recycle_buffers_;
+		}
+
+		/**
+		 *	@brief	Enables memoization of fitness
+		 *
+		 *	@details Members not modified by genetic operators since their last evaluation
+		 *			 keep their fitness, modified members are looked up in a cache of given
+		 *			 capacity (CLOCK eviction) and evaluated only when missing. Capacity 0
+		 *			 disables cache, but unmodified members are still skipped
+		 *
+		 *	@note	Fitness has to depend only on Genotype of evaluated Specimen
+		 *	@note	Genotype has to be equality comparable and hashable with GenotypeHash
+		 *
+		 *	@see	FitnessCache
+		 *	@see	getEvaluationStatistics()
+		 */
+		void setEvaluationCache(size_type capacity)
+		{
+			memoization_ = true;
+
+			if (capacity > 0)
+				evaluation_cache_ = std::make_unique<FitnessCache<Genotype> >(capacity);
+			else
+				evaluation_cache_.reset();
+		}
+
+		/**
+		 *	@brief	Disables memoization, every member is evaluated in every generation
+		 */
+		void disableEvaluationCache()
+		{
+			memoization_ = false;
+			evaluation_cache_.reset();
+		}
+
+		bool isEvaluationCacheEnabled() const
+		{
+			return memoization_;
+		}
+
+		/**
+		 *	@brief	Counters of skipped members, cache hits and misses since last reset
+		 */
+		const EvaluationStatistics& getEvaluationStatistics() const
+		{
+			return evaluation_statistics_;
+		}
+
+		void resetEvaluationStatistics()
+		{
+			evaluation_statistics_ = EvaluationStatistics();
+		}
+
+		/**
+		 *	@brief	Enables recording of time and counters of every generation
+		 *
+		 *	@details Records are accessible trough getInstrumentation() and can be
+		 *			 exported as CSV or JSON lines. Has no effect when library is
+		 *			 compiled with GA_DISABLE_INSTRUMENTATION
+		 *
+		 *	@see	Instrumentation
+		 */
+		void setInstrumentation(bool enabled)
+		{
+			instrumentation_.setEnabled(enabled);
+		}
+
+		Instrumentation&		getInstrumentation()	   { return instrumentation_; }
+		const Instrumentation&	getInstrumentation() const { return instrumentation_; }
+
+		/**
+		 *	@brief	Seeds random number generator of environment
+		 *
+		 *	@details Environment binds its generator to current thread (see ga::getRandom())
+		 *			 for the time of evolution, so two environments with equal seeds,
+		 *			 settings and initial population evolve identically. By default
+		 *			 environment is seeded with a number drawn from ga::getRandom() at
+		 *			 construction, so ga::getRandom().setSeed() called before constructing
+		 *			 environment makes initial population reproducible as well
+		 */
+		void setSeed(uint64_t seed)
+		{
+			random_.setSeed(seed);
+		}
+
+		void setRandom(const Random& random)
+		{
+			random_ = random;
+		}
+
+		Random& getRandom()
+		{
+			return random_;
+		}
+
 		//	Get/set population
 		void setPopulation(const Population& population)
 		{
 			population_ = population;
+			stats_ = GenerationStats();
+			stats_valid_ = false;
 		}
 
 		void setPopulation(Population&& population)
 		{
-			population_ = population;
+			population_ = std::move(population);
+			stats_ = GenerationStats();
+			stats_valid_ = false;
 		}
 
 		const Population& getPopulation() const
@@ -280,6 +1057,28 @@ namespace ga {
 			return population_;
 		}
 
+		/**
+		 *	@brief	Statistics of fitness of current population
+		 *
+		 *	@details Updated after every evaluation of population, generation is the
+		 *			 number of iterations performed on current population
+		 */
+		const GenerationStats& getGenerationStats() const
+		{
+			return stats_;
+		}
+
+		/**
+		 *	@brief	Fitness of current population in one contiguous array
+		 *
+		 *	@details Element i is fitness of member i of getPopulation(). Updated together
+		 *			 with statistics, after every evaluation of population
+		 */
+		const std::vector<double>& getFitnessColumn() const
+		{
+			return fitness_column_;
+		}
+
 		//	For Strategies with strictly specified Gene/Specimen type
 		template <typename MutationType, typename... Args>
 		void setMutationType(Args&&... args)
@@ -302,19 +1101,20 @@ namespace ga {
 			selection_type_ = std::make_unique<SelectionType>(std::forward<Args>(args)...);
 		}
 
-		//	Generic function templates taking a specified strategy
-		template <template <typename T> typename MutationType, typename... Args>
+		//	Generic function templates taking a specified strategy, instantiated with
+		//	Gene (and Genotype if Specimen doesn't store Genes in std::vector)
+		template <template <typename...> typename MutationType, typename... Args>
 		void setMutationType(Args&&... args)
 		{
 			mutation_type_.reset();
-			mutation_type_ = std::make_unique<MutationType<Gene> >(std::forward<Args>(args)...);
+			mutation_type_ = std::make_unique<typename BindOperator<MutationType, Gene, Genotype>::type>(std::forward<Args>(args)...);
 		}
 
-		template <template <typename T> typename CrossoverType, typename... Args>
+		template <template <typename...> typename CrossoverType, typename... Args>
 		void setCrossoverType(Args&&... args)
 		{
 			crossover_type_.reset();
-			crossover_type_ = std::make_unique<CrossoverType<Gene> >(std::forward<Args>(args)...);
+			crossover_type_ = std::make_unique<typename BindOperator<CrossoverType, Gene, Genotype>::type>(std::forward<Args>(args)...);
 		}
 
 		template <template <typename T> typename SelectionType, typename... Args>
@@ -323,6 +1123,112 @@ namespace ga {
 			selection_type_.reset();
 			selection_type_ = std::make_unique<SelectionType<SpecimenType> >(std::forward<Args>(args)...);
 		}
+
+		/**
+		 *	@brief	Sets strategy choosing next generation from population and offspring
+		 *
+		 *	@details By default offspring replaces population. With succession set
+		 *			 offspring is evaluated before reproduction
+		 *
+		 *	@see	Succession
+		 */
+		template <typename SuccessionType, typename... Args>
+		void setSuccessionType(Args&&... args)
+		{
+			succession_type_ = std::make_unique<SuccessionType>(std::forward<Args>(args)...);
+		}
+
+		template <template <typename T> typename SuccessionType, typename... Args>
+		void setSuccessionType(Args&&... args)
+		{
+			succession_type_ = std::make_unique<SuccessionType<SpecimenType> >(std::forward<Args>(args)...);
+		}
+
+		/**
+		 *	@brief	Sets local search applied to offspring after mutation (memetic algorithm)
+		 *
+		 *	@details Members are improved concurrently with executor of environment,
+		 *			 so local search has to be thread safe
+		 *
+		 *	@see	LocalSearch
+		 */
+		template <typename LocalSearchType, typename... Args>
+		void setLocalSearchType(Args&&... args)
+		{
+			local_search_type_ = std::make_unique<LocalSearchType>(std::forward<Args>(args)...);
+		}
+
+		//	Local search taking a problem (e.g. TwoOptSearch), instantiated with Gene and type of problem
+		template <template <typename...> typename LocalSearchType, typename Problem, typename... Args>
+		void setLocalSearchType(const Problem& problem, Args&&... args)
+		{
+			local_search_type_ = std::make_unique<LocalSearchType<Gene, Problem, Genotype> >(problem, std::forward<Args>(args)...);
+		}
+
+		void disableLocalSearch()
+		{
+			local_search_type_.reset();
+		}
+
+		/**
+		 *	@brief	Sets fraction of offspring improved by local search, 1.0 by default
+		 */
+		void setLocalSearchRate(double local_search_rate)
+		{
+			local_search_rate_ = std::min(1.0, std::max(0.0, local_search_rate));
+		}
+
+		double getLocalSearchRate() const
+		{
+			return local_search_rate_;
+		}
+
+		/**
+		 *	@brief	Restores default succession - offspring replaces population
+		 */
+		void resetSuccessionType()
+		{
+			succession_type_.reset();
+		}
+
+		/**
+		 *	@brief	Sets number of offspring created every generation (lambda)
+		 *
+		 *	@details 0 (default) creates as many offspring as there are members of
+		 *			 population. Different number makes sense only with succession
+		 *			 keeping population size, e.g. PlusSuccession or CommaSuccession
+		 */
+		void setOffspringSize(size_type offspring_size)
+		{
+			offspring_size_ = offspring_size;
+		}
+
+		size_type getOffspringSize() const
+		{
+			return offspring_size_ == 0 ? population_.size() : offspring_size_;
+		}
+
+		/**
+		 *	@brief	Sets executor used for evaluation of population
+		 *
+		 *	@details SequentialExecutor is used by default, set ThreadPoolExecutor
+		 *			 to evaluate population and apply genetic operators in parallel
+		 *			 (fitness function and operators have to be thread safe then).
+		 *			 Crossover, mutation and local search draw random numbers from
+		 *			 streams of individual members, so evolution with given seed is
+		 *			 identical for any number of threads
+		 */
+		template <typename ExecutorType, typename... Args>
+		void setExecutor(Args&&... args)
+		{
+			executor_.reset();
+			executor_ = std::make_unique<ExecutorType>(std::forward<Args>(args)...);
+		}
+
+		Executor& getExecutor() const
+		{
+			return *executor_;
+		}
 	};
 
 }
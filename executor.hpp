@@ -0,0 +1,243 @@
+/**
+ *	Executors used by environment to distribute independent work,
+ *	like fitness evaluation of every member of population. Default
+ *	executor runs everything on calling thread, thread pool executor
+ *	splits work into chunks and distributes them between reusable
+ *	worker threads
+ *
+ *	Authors: Michal Swiatek, Michal Sulek
+ *	Update:	 17.10.2026
+ *
+ *	Github repository: https://github.com/MichalKonradSulek/ZPR
+ */
+
+#ifndef __EXECUTOR__
+#define __EXECUTOR__
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <algorithm>
+#include <exception>
+#include <functional>
+#include <condition_variable>
+
+namespace ga {
+
+	/**
+	 *	@brief	Base class representing a way of executing independent tasks
+	 *
+	 *	@details Executor receives a range of indices and a body that processes
+	 *			 a contiguous subrange [begin, end) of it. Body can be called
+	 *			 concurrently for disjoint subranges, so it has to be thread safe
+	 *
+	 *	@note	parallelFor(size_type begin, size_type end, const Task& body) must be overriden
+	 */
+	class Executor
+	{
+	public:
+		using size_type = size_t;
+		using Task		= std::function<void(size_type, size_type)>;
+
+		virtual ~Executor() = default;
+
+		/**
+		 *	@brief	Processes range [begin, end) with given body
+		 *
+		 *	@details Function returns after whole range has been processed. If body
+		 *			 throws, first exception is rethrown on calling thread
+		 */
+		virtual void parallelFor(size_type begin, size_type end, const Task& body) = 0;
+
+		/**
+		 *	@brief	Number of threads that can process range simultaneously
+		 */
+		virtual size_type getConcurrency() const = 0;
+	};
+
+	/**
+	 *	@brief	Executor processing whole range on calling thread
+	 *
+	 *	@details Default executor of environment, use it with fitness functions
+	 *			 that are not thread safe
+	 */
+	class SequentialExecutor : public Executor
+	{
+	public:
+		void parallelFor(size_type begin, size_type end, const Task& body) override
+		{
+			if (begin < end)
+				body(begin, end);
+		}
+
+		size_type getConcurrency() const override { return 1; }
+	};
+
+	/**
+	 *	@brief	Executor distributing chunks of range between pool of threads
+	 *
+	 *	@details Worker threads are created once and reused for every parallelFor()
+	 *			 call. Range is split into chunks which are picked by workers (and
+	 *			 calling thread) from shared atomic counter, so faster threads
+	 *			 process more chunks when cost of tasks is uneven
+	 *
+	 *	@note	Calling parallelFor() from inside of a body runs nested range
+	 *			sequentially on current thread
+	 */
+	class ThreadPoolExecutor : public Executor
+	{
+	private:
+		std::vector<std::thread> workers_;
+
+		std::mutex				mutex_;
+		std::condition_variable	work_ready_;
+		std::condition_variable	work_done_;
+
+		const Task*				task_;
+		size_type				end_;
+		size_type				chunk_size_;
+		std::atomic<size_type>	next_;
+
+		size_type			job_;
+		size_type			finished_workers_;
+		bool				stop_;
+		std::exception_ptr	error_;
+
+		size_type user_chunk_size_;
+
+		static bool& insideTask()
+		{
+			thread_local bool inside = false;
+			return inside;
+		}
+
+		void processChunks()
+		{
+			insideTask() = true;
+
+			for (size_type begin = next_.fetch_add(chunk_size_); begin < end_; begin = next_.fetch_add(chunk_size_))
+			{
+				try
+				{
+					(*task_)(begin, std::min(begin + chunk_size_, end_));
+				}
+				catch (...)
+				{
+					std::lock_guard<std::mutex> lock(mutex_);
+					if (!error_)
+						error_ = std::current_exception();
+
+					//	Skip remaining chunks
+					next_ = end_;
+				}
+			}
+
+			insideTask() = false;
+		}
+
+		void workerLoop()
+		{
+			size_type seen_job = 0;
+
+			while (true)
+			{
+				{
+					std::unique_lock<std::mutex> lock(mutex_);
+					work_ready_.wait(lock, [this, seen_job] { return stop_ || job_ != seen_job; });
+
+					if (stop_)
+						return;
+
+					seen_job = job_;
+				}
+
+				processChunks();
+
+				std::lock_guard<std::mutex> lock(mutex_);
+				if (++finished_workers_ == workers_.size())
+					work_done_.notify_one();
+			}
+		}
+
+	public:
+		/**
+		 *	@param	number_of_threads	Number of threads processing range including calling
+		 *			thread, by default equal to hardware concurrency
+		 *	@param	chunk_size			Number of indices processed in one task call, set to 0
+		 *			to split every range into 4 chunks per thread
+		 */
+		explicit ThreadPoolExecutor(size_type number_of_threads = std::thread::hardware_concurrency(), size_type chunk_size = 0)
+			: task_(nullptr), end_(0), chunk_size_(1), next_(0), job_(0), finished_workers_(0), stop_(false), user_chunk_size_(chunk_size)
+		{
+			if (number_of_threads == 0)
+				number_of_threads = 1;
+
+			workers_.reserve(number_of_threads - 1);
+			for (size_type i = 1; i < number_of_threads; ++i)
+				workers_.emplace_back(&ThreadPoolExecutor::workerLoop, this);
+		}
+
+		ThreadPoolExecutor(const ThreadPoolExecutor&) = delete;
+		ThreadPoolExecutor& operator=(const ThreadPoolExecutor&) = delete;
+
+		~ThreadPoolExecutor() override
+		{
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				stop_ = true;
+			}
+			work_ready_.notify_all();
+
+			for (auto& worker : workers_)
+				worker.join();
+		}
+
+		void parallelFor(size_type begin, size_type end, const Task& body) override
+		{
+			if (begin >= end)
+				return;
+
+			size_type size = end - begin;
+			size_type chunk_size = user_chunk_size_ != 0 ? user_chunk_size_ : std::max<size_type>(1, size / (4 * getConcurrency()));
+
+			if (workers_.empty() || insideTask() || size <= chunk_size)
+			{
+				body(begin, end);
+				return;
+			}
+
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				task_ = &body;
+				end_ = end;
+				chunk_size_ = chunk_size;
+				next_ = begin;
+				finished_workers_ = 0;
+				error_ = nullptr;
+				++job_;
+			}
+			work_ready_.notify_all();
+
+			processChunks();
+
+			std::exception_ptr error;
+			{
+				std::unique_lock<std::mutex> lock(mutex_);
+				work_done_.wait(lock, [this] { return finished_workers_ == workers_.size(); });
+
+				task_ = nullptr;
+				error = error_;
+				error_ = nullptr;
+			}
+
+			if (error)
+				std::rethrow_exception(error);
+		}
+
+		size_type getConcurrency() const override { return workers_.size() + 1; }
+	};
+
+}
+
+#endif // !__EXECUTOR__
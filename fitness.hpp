@@ -0,0 +1,115 @@
+/**
+ *	Interfaces of fitness functions that can be evaluated more efficiently
+ *	than by calling them on every member of population separately:
+ *	incrementally from recorded changes or in batches of members
+ *
+ *	Authors: Michal Swiatek, Michal Sulek
+ *	Update:	 17.10.2026
+ *
+ *	Github repository: https://github.com/MichalKonradSulek/ZPR
+ */
+
+#ifndef __FITNESS__
+#define __FITNESS__
+
+#include <cstddef>
+
+#include "change_set.hpp"
+
+namespace ga {
+
+	/**
+	 *	@brief	Fitness function that can be evaluated incrementally
+	 *
+	 *	@details Genetic operators record which genes they modify in change set of
+	 *			 Specimen. When change set isn't full, environment calls evaluateDelta()
+	 *			 with fitness from previous evaluation, so that only contribution of
+	 *			 modified genes has to be recomputed. Full evaluation with operator()
+	 *			 is used for new Specimens, after whole Genotype was modified and when
+	 *			 evaluateDelta() returns false
+	 *
+	 *	@tparam	SpecimenType Type of evaluated Specimen
+	 *
+	 *	@note	Fitness has to depend only on Genotype of Specimen
+	 *	@note	Both functions are called concurrently when environment uses parallel executor
+	 *
+	 *	@see	ChangeSet
+	 *	@see	Mutation::performTrackedMutation
+	 *	@see	Crossover::crossTracked
+	 */
+	template <typename SpecimenType>
+	class DeltaFitness
+	{
+	public:
+		using Gene		= typename SpecimenType::Gene;
+		using Changes	= typename ChangeSetOf<Gene, typename SpecimenType::Genotype>::type;
+
+		virtual ~DeltaFitness() = default;
+
+		/**
+		 *	@brief	Full evaluation of Specimen
+		 */
+		virtual double operator()(const SpecimenType& specimen) const = 0;
+
+		/**
+		 *	@brief	Incremental evaluation of Specimen
+		 *
+		 *	@param	specimen	Specimen with modified Genotype
+		 *	@param	old_fitness	Fitness of Specimen before modifications
+		 *	@param	changes		Modified genes and their previous values
+		 *	@param	fitness		New fitness of Specimen
+		 *
+		 *	@return	False if fitness can't be computed incrementally
+		 */
+		virtual bool evaluateDelta(const SpecimenType& specimen, double old_fitness, const Changes& changes, double& fitness) const = 0;
+	};
+
+	/**
+	 *	@brief	Fitness function evaluating many members in one call
+	 *
+	 *	@details Environment passes contiguous ranges of population and receives
+	 *			 fitness of every member in a flat array, so evaluation can be
+	 *			 vectorized (e.g. over genes of many members at once) or handed
+	 *			 to an external solver in one call. Range is a chunk of population
+	 *			 assigned to one thread of executor
+	 *
+	 *	@tparam	SpecimenType Type of evaluated Specimen
+	 *
+	 *	@note	Fitness has to depend only on Genotype of Specimen
+	 *	@note	evaluateBatch() is called concurrently for disjoint ranges when
+	 *			environment uses parallel executor
+	 *
+	 *	@see	Environment::getFitnessColumn
+	 */
+	template <typename SpecimenType>
+	class BatchFitness
+	{
+	public:
+		using size_type = size_t;
+
+		virtual ~BatchFitness() = default;
+
+		/**
+		 *	@brief	Evaluates members [members, members + count)
+		 *
+		 *	@param	members	First member of evaluated range
+		 *	@param	count	Number of members in range
+		 *	@param	fitness	Output array, fitness[i] is fitness of members[i]
+		 */
+		virtual void evaluateBatch(const SpecimenType* members, size_type count, double* fitness) const = 0;
+
+		/**
+		 *	@brief	Evaluates single member as a batch of size one
+		 */
+		double operator()(const SpecimenType& specimen) const
+		{
+			double fitness;
+			evaluateBatch(&specimen, 1, &fitness);
+
+			return fitness;
+		}
+	};
+
+}
+
+#endif // !__FITNESS__
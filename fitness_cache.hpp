@@ -0,0 +1,275 @@
+/**
+ *	Bounded cache of fitness values keyed by Genotype. With strong
+ *	selection pressure many members of a generation are copies of the
+ *	same parents, cache allows environment to evaluate each of them once
+ *
+ *	Authors: Michal Swiatek, Michal Sulek
+ *	Update:	 17.10.2026
+ *
+ *	Github repository: https://github.com/MichalKonradSulek/ZPR
+ */
+
+#ifndef __FITNESS_CACHE__
+#define __FITNESS_CACHE__
+
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <functional>
+
+#include "bit_genotype.hpp"
+
+namespace ga {
+
+	namespace detail {
+
+		inline uint64_t combineHash(uint64_t hash, uint64_t value)
+		{
+			return ((hash << 5 | hash >> 59) ^ value) * 0x517CC1B727220A95ULL;
+		}
+
+		inline uint64_t finalizeHash(uint64_t hash)
+		{
+			hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ULL;
+			hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBULL;
+			return hash ^ (hash >> 31);
+		}
+
+	}
+
+	/**
+	 *	@brief	Hash of Genotype used by FitnessCache
+	 *
+	 *	@details Combines std::hash of every Gene, specialize it for custom Genotypes
+	 *			 or Genes without std::hash
+	 */
+	template <typename GenotypeType>
+	struct GenotypeHash
+	{
+		uint64_t operator()(const GenotypeType& genotype) const
+		{
+			using Gene = typename GenotypeType::value_type;
+
+			std::hash<Gene> gene_hash;
+			uint64_t hash = genotype.size();
+
+			for (const Gene& gene : genotype)
+				hash = detail::combineHash(hash, gene_hash(gene));
+
+			return detail::finalizeHash(hash);
+		}
+	};
+
+	/**
+	 *	@brief	Hash of packed boolean genes, computed word by word
+	 */
+	template <>
+	struct GenotypeHash<BitGenotype>
+	{
+		uint64_t operator()(const BitGenotype& genotype) const
+		{
+			uint64_t hash = genotype.size();
+
+			const BitGenotype::Word* words = genotype.data();
+			for (size_t i = 0; i < genotype.wordCount(); ++i)
+				hash = detail::combineHash(hash, words[i]);
+
+			return detail::finalizeHash(hash);
+		}
+	};
+
+	/**
+	 *	@brief	Counters of evaluations performed with cache enabled
+	 *
+	 *	@details skipped - members not modified since last evaluation
+	 *			 hits	 - modified members found in cache
+	 *			 misses	 - modified members evaluated with fitness function
+	 */
+	struct EvaluationStatistics
+	{
+		size_t skipped	= 0;
+		size_t hits		= 0;
+		size_t misses	= 0;
+	};
+
+	/**
+	 *	@brief	Bounded map from Genotype to fitness with CLOCK eviction
+	 *
+	 *	@details Entries are stored in preallocated slots, evicted entry's Genotype
+	 *			 storage is reused by new one. Lookup uses open addressing table of
+	 *			 slot indices with linear probing, hashes are compared first and
+	 *			 Genotypes are compared in full only when hashes are equal
+	 *
+	 *	@tparam	GenotypeType Container of Genes, has to be equality comparable
+	 *	@tparam	Hash		 Functor returning 64 bit hash of Genotype
+	 *
+	 *	@note	Cache is not thread safe
+	 */
+	template <typename GenotypeType, typename Hash = GenotypeHash<GenotypeType> >
+	class FitnessCache
+	{
+	public:
+		using size_type = size_t;
+		using Genotype	= GenotypeType;
+
+	private:
+		struct Entry
+		{
+			Genotype	genotype;
+			uint64_t	hash;
+			double		fitness;
+			bool		referenced;
+		};
+
+		std::vector<Entry>		entries_;
+
+		//	Slot index + 1 of entry, 0 marks empty position
+		std::vector<size_type>	table_;
+		size_type				mask_;
+
+		size_type	capacity_;
+		size_type	hand_;
+
+		Hash hash_function_;
+
+		size_type findPosition(const Genotype& genotype, uint64_t hash) const
+		{
+			for (size_type position = hash & mask_; table_[position] != 0; position = (position + 1) & mask_)
+			{
+				const Entry& entry = entries_[table_[position] - 1];
+				if (entry.hash == hash && entry.genotype == genotype)
+					return position;
+			}
+
+			return table_.size();
+		}
+
+		void link(size_type slot)
+		{
+			size_type position = entries_[slot].hash & mask_;
+			while (table_[position] != 0)
+				position = (position + 1) & mask_;
+
+			table_[position] = slot + 1;
+		}
+
+		//	Backward shift deletion keeps probe sequences unbroken without tombstones
+		void unlink(size_type slot)
+		{
+			size_type hole = entries_[slot].hash & mask_;
+			while (table_[hole] != slot + 1)
+				hole = (hole + 1) & mask_;
+
+			for (size_type next = (hole + 1) & mask_; table_[next] != 0; next = (next + 1) & mask_)
+			{
+				size_type home = entries_[table_[next] - 1].hash & mask_;
+				if (((next - home) & mask_) >= ((next - hole) & mask_))
+				{
+					table_[hole] = table_[next];
+					hole = next;
+				}
+			}
+
+			table_[hole] = 0;
+		}
+
+		size_type evict()
+		{
+			while (entries_[hand_].referenced)
+			{
+				entries_[hand_].referenced = false;
+				hand_ = (hand_ + 1) % capacity_;
+			}
+
+			size_type slot = hand_;
+			hand_ = (hand_ + 1) % capacity_;
+
+			unlink(slot);
+			return slot;
+		}
+
+	public:
+		/**
+		 *	@param	capacity Maximum number of stored Genotypes
+		 */
+		explicit FitnessCache(size_type capacity) : capacity_(capacity), hand_(0)
+		{
+			size_type table_size = 1;
+			while (table_size < 2 * capacity_)
+				table_size *= 2;
+
+			table_.assign(table_size, 0);
+			mask_ = table_size - 1;
+
+			entries_.reserve(capacity_);
+		}
+
+		uint64_t hash(const Genotype& genotype) const { return hash_function_(genotype); }
+
+		/**
+		 *	@brief	Looks up fitness of Genotype with given hash
+		 *
+		 *	@return	True if Genotype was found, its fitness is assigned to fitness
+		 */
+		bool find(const Genotype& genotype, uint64_t hash, double& fitness)
+		{
+			size_type position = findPosition(genotype, hash);
+			if (position == table_.size())
+				return false;
+
+			Entry& entry = entries_[table_[position] - 1];
+			entry.referenced = true;
+			fitness = entry.fitness;
+
+			return true;
+		}
+
+		/**
+		 *	@brief	Stores fitness of Genotype, evicts an entry if cache is full
+		 */
+		void insert(const Genotype& genotype, uint64_t hash, double fitness)
+		{
+			if (capacity_ == 0)
+				return;
+
+			size_type position = findPosition(genotype, hash);
+			if (position != table_.size())
+			{
+				entries_[table_[position] - 1].fitness = fitness;
+				return;
+			}
+
+			size_type slot;
+			if (entries_.size() < capacity_)
+			{
+				slot = entries_.size();
+				entries_.push_back(Entry{ genotype, hash, fitness, false });
+			}
+			else
+			{
+				slot = evict();
+
+				Entry& entry = entries_[slot];
+				entry.genotype = genotype;
+				entry.hash = hash;
+				entry.fitness = fitness;
+				entry.referenced = false;
+			}
+
+			link(slot);
+		}
+
+		void clear()
+		{
+			entries_.clear();
+			std::fill(table_.begin(), table_.end(), 0);
+			hand_ = 0;
+		}
+
+		size_type size() const		{ return entries_.size(); }
+		size_type capacity() const	{ return capacity_; }
+	};
+
+}
+
+#endif // !__FITNESS_CACHE__
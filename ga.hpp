@@ -2,16 +2,35 @@
 #define __GA__
 
 #include "specimen.hpp"
+#include "bit_genotype.hpp"
+#include "change_set.hpp"
+#include "gene_matrix.hpp"
 
 #include "mutation.hpp"
 #include "crossover.hpp"
 #include "selection.hpp"
+#include "local_search.hpp"
+#include "succession.hpp"
+#include "fitness.hpp"
+#include "fitness_cache.hpp"
 
 #include "Predefined/mutations.hpp"
 #include "Predefined/crossovers.hpp"
+#include "Predefined/permutation_crossovers.hpp"
+#include "Predefined/real_crossovers.hpp"
+#include "Predefined/real_mutations.hpp"
+#include "Predefined/local_searches.hpp"
 #include "Predefined/selections.hpp"
+#include "Predefined/successions.hpp"
 
+#include "executor.hpp"
+#include "instrumentation.hpp"
+#include "generation_stats.hpp"
 #include "environment.hpp"
+#include "static_environment.hpp"
+#include "matrix_environment.hpp"
+#include "island_environment.hpp"
+#include "steady_state_environment.hpp"
 
 #include "Predefined/ga_utility.hpp"
 
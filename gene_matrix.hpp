@@ -0,0 +1,338 @@
+/**
+ *	Population of fixed length Genotypes stored as one contiguous matrix
+ *	of genes (row per member) with fitness kept in a separate column.
+ *	Members are accessed trough lightweight views, their Genotypes are
+ *	row views that predefined genetic operators work on directly
+ *
+ *	Authors: Michal Swiatek, Michal Sulek
+ *	Update:	 17.10.2026
+ *
+ *	Github repository: https://github.com/MichalKonradSulek/ZPR
+ */
+
+#ifndef __GENE_MATRIX__
+#define __GENE_MATRIX__
+
+#include <vector>
+#include <memory>
+#include <iostream>
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+#include <type_traits>
+
+#include "change_set.hpp"
+
+namespace ga {
+
+	/**
+	 *	@brief	View of a fixed length row of genes
+	 *
+	 *	@details Behaves like a container of fixed size (size(), operator[], random
+	 *			 access iterators), so it can be used as GenotypeType of genetic
+	 *			 operators, e.g. SwapGeneMutation<int, GeneRow<int> >. Copying a row
+	 *			 copies the view, not the genes
+	 */
+	template <typename GeneType>
+	class GeneRow
+	{
+	public:
+		using value_type		= GeneType;
+		using size_type			= size_t;
+		using difference_type	= ptrdiff_t;
+		using reference			= GeneType&;
+		using const_reference	= const GeneType&;
+		using iterator			= GeneType*;
+		using const_iterator	= const GeneType*;
+
+	private:
+		GeneType*	data_;
+		size_type	size_;
+
+	public:
+		GeneRow() : data_(nullptr), size_(0) { }
+		GeneRow(GeneType* data, size_type size) : data_(data), size_(size) { }
+
+		size_type size() const { return size_; }
+		bool empty() const { return size_ == 0; }
+
+		GeneType*		data()		 { return data_; }
+		const GeneType*	data() const { return data_; }
+
+		reference		operator[](size_type position)		 { return data_[position]; }
+		const_reference	operator[](size_type position) const { return data_[position]; }
+
+		iterator		begin()		  { return data_; }
+		iterator		end()		  { return data_ + size_; }
+		const_iterator	begin() const { return data_; }
+		const_iterator	end() const	  { return data_ + size_; }
+
+		bool operator==(const GeneRow& other) const { return size_ == other.size_ && std::equal(begin(), end(), other.begin()); }
+		bool operator!=(const GeneRow& other) const { return !(*this == other); }
+	};
+
+	/**
+	 *	@brief	Matrix of genes stored in one aligned block of memory
+	 *
+	 *	@details Every row starts at a cache line boundary: when size of Gene divides
+	 *			 cache line, rows are padded to whole cache lines. Padding genes are
+	 *			 never accessed trough rows
+	 *
+	 *	@tparam	GeneType Trivially copyable type of Gene
+	 */
+	template <typename GeneType>
+	class GeneMatrix
+	{
+		static_assert(std::is_trivially_copyable<GeneType>::value, "GeneMatrix requires trivially copyable genes");
+
+	public:
+		using size_type = size_t;
+
+		static const size_type ALIGNMENT = 64;
+
+	private:
+		std::unique_ptr<unsigned char[]>	storage_;
+		GeneType*							data_	= nullptr;
+
+		size_type rows_		= 0;
+		size_type length_	= 0;
+		size_type stride_	= 0;
+
+		static size_type strideOf(size_type length)
+		{
+			if (ALIGNMENT % sizeof(GeneType) != 0)
+				return length;
+
+			size_type genes_per_line = ALIGNMENT / sizeof(GeneType);
+			return (length + genes_per_line - 1) / genes_per_line * genes_per_line;
+		}
+
+	public:
+		GeneMatrix() = default;
+
+		GeneMatrix(size_type rows, size_type length) { resize(rows, length); }
+
+		GeneMatrix(const GeneMatrix& other) : GeneMatrix(other.rows_, other.length_)
+		{
+			std::copy(other.data_, other.data_ + rows_ * stride_, data_);
+		}
+
+		GeneMatrix(GeneMatrix&&) = default;
+
+		GeneMatrix& operator=(const GeneMatrix& other)
+		{
+			if (this != &other)
+			{
+				if (rows_ != other.rows_ || length_ != other.length_)
+					resize(other.rows_, other.length_);
+
+				std::copy(other.data_, other.data_ + rows_ * stride_, data_);
+			}
+
+			return *this;
+		}
+
+		GeneMatrix& operator=(GeneMatrix&&) = default;
+
+		/**
+		 *	@brief	Reallocates matrix, genes are value initialized
+		 */
+		void resize(size_type rows, size_type length)
+		{
+			rows_ = rows;
+			length_ = length;
+			stride_ = strideOf(length);
+
+			size_type genes = rows_ * stride_;
+			storage_.reset(new unsigned char[genes * sizeof(GeneType) + ALIGNMENT]);
+
+			uintptr_t address = reinterpret_cast<uintptr_t>(storage_.get());
+			data_ = reinterpret_cast<GeneType*>((address + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT);
+
+			std::uninitialized_fill_n(data_, genes, GeneType());
+		}
+
+		size_type getRows() const { return rows_; }
+		size_type getLength() const { return length_; }
+
+		/**
+		 *	@brief	Distance between beginnings of consecutive rows, in genes
+		 */
+		size_type getStride() const { return stride_; }
+
+		GeneType*		data()		 { return data_; }
+		const GeneType*	data() const { return data_; }
+
+		GeneRow<GeneType>		row(size_type index)	   { return GeneRow<GeneType>(data_ + index * stride_, length_); }
+		GeneRow<const GeneType>	row(size_type index) const { return GeneRow<const GeneType>(data_ + index * stride_, length_); }
+
+		void copyRow(size_type index, const GeneMatrix& source, size_type source_index)
+		{
+			const GeneType* first = source.data_ + source_index * source.stride_;
+			std::copy(first, first + length_, data_ + index * stride_);
+		}
+
+		void swap(GeneMatrix& other)
+		{
+			storage_.swap(other.storage_);
+			std::swap(data_, other.data_);
+			std::swap(rows_, other.rows_);
+			std::swap(length_, other.length_);
+			std::swap(stride_, other.stride_);
+		}
+	};
+
+	/**
+	 *	@brief	View of a member of MatrixPopulation
+	 *
+	 *	@details Provides interface of Specimen used by environment and fitness
+	 *			 functions: Genotype (row of gene matrix), fitness, change set and
+	 *			 modification flag. Fenotype is equal to Genotype. Views are cheap
+	 *			 to copy and stay valid until population is resized or swapped
+	 *
+	 *	@tparam	GeneType Type of Gene
+	 */
+	template <typename GeneType>
+	class MatrixSpecimen
+	{
+	public:
+		using Gene		= GeneType;
+		using Genotype	= GeneRow<GeneType>;
+		using Fenotype	= GeneRow<GeneType>;
+
+	private:
+		Genotype			genes_;
+		double*				fitness_;
+		ChangeSet<Gene>*	changes_;
+		uint8_t*			modified_;
+
+	public:
+		MatrixSpecimen(Genotype genes, double* fitness, ChangeSet<Gene>* changes, uint8_t* modified)
+			: genes_(genes), fitness_(fitness), changes_(changes), modified_(modified) { }
+
+		const Genotype& getGenotype() const { return genes_; }
+		const Fenotype& getFenotypeView() const { return genes_; }
+
+		/**
+		 *	@brief	Access to Genotype for modification, whole row is treated as modified
+		 */
+		Genotype& getGenotype()
+		{
+			changes_->markAll();
+			markModified();
+
+			return genes_;
+		}
+
+		/**
+		 *	@brief	Access to Genotype for modification recorded in getChanges()
+		 */
+		Genotype& getTrackedGenotype() { return genes_; }
+
+		ChangeSet<Gene>&		getChanges()	   { return *changes_; }
+		const ChangeSet<Gene>&	getChanges() const { return *changes_; }
+
+		void markModified() { *modified_ = 1; }
+		void markEvaluated() { *modified_ = 0; }
+		bool isModified() const { return *modified_ != 0; }
+
+		double	getFitness() const { return *fitness_; }
+		void	setFitness(double fitness) { *fitness_ = fitness; }
+
+		void print() const
+		{
+			std::cout << *fitness_ << '\n';
+		}
+	};
+
+	/**
+	 *	@brief	Population of Genotypes of equal length stored as structure of arrays
+	 *
+	 *	@details Genes of all members are kept in one GeneMatrix, fitness in one
+	 *			 contiguous column, so whole population takes a few blocks of memory
+	 *			 regardless of its size. Members are accessed with operator[], which
+	 *			 returns a MatrixSpecimen view
+	 *
+	 *	@tparam	GeneType Trivially copyable type of Gene
+	 *
+	 *	@see	MatrixEnvironment
+	 */
+	template <typename GeneType>
+	class MatrixPopulation
+	{
+	public:
+		using size_type	= size_t;
+		using Gene		= GeneType;
+		using Member	= MatrixSpecimen<GeneType>;
+
+	private:
+		GeneMatrix<Gene>				genes_;
+		std::vector<double>				fitness_;
+		std::vector<ChangeSet<Gene> >	changes_;
+		std::vector<uint8_t>			modified_;
+
+	public:
+		MatrixPopulation() = default;
+
+		MatrixPopulation(size_type size, size_type length) { resize(size, length); }
+
+		/**
+		 *	@brief	Reallocates population, every member is modified and has fitness 0
+		 */
+		void resize(size_type size, size_type length)
+		{
+			genes_.resize(size, length);
+			fitness_.assign(size, 0.0);
+			changes_.assign(size, ChangeSet<Gene>());
+			modified_.assign(size, 1);
+		}
+
+		size_type size() const { return fitness_.size(); }
+		bool empty() const { return fitness_.empty(); }
+
+		size_type getLength() const { return genes_.getLength(); }
+
+		Member operator[](size_type index)
+		{
+			return Member(genes_.row(index), &fitness_[index], &changes_[index], &modified_[index]);
+		}
+
+		//	Views of constant population are used only for reading
+		Member operator[](size_type index) const
+		{
+			return const_cast<MatrixPopulation&>(*this)[index];
+		}
+
+		/**
+		 *	@brief	Copies genes, fitness and state of member of other population of equal length
+		 */
+		void copyMember(size_type index, const MatrixPopulation& source, size_type source_index)
+		{
+			genes_.copyRow(index, source.genes_, source_index);
+			fitness_[index] = source.fitness_[source_index];
+			changes_[index] = source.changes_[source_index];
+			modified_[index] = source.modified_[source_index];
+		}
+
+		GeneMatrix<Gene>&		getGenes()		 { return genes_; }
+		const GeneMatrix<Gene>&	getGenes() const { return genes_; }
+
+		/**
+		 *	@brief	Fitness of members in one contiguous array
+		 */
+		const std::vector<double>& getFitnessColumn() const { return fitness_; }
+
+		double*	getFitnessData() { return fitness_.data(); }
+
+		void swap(MatrixPopulation& other)
+		{
+			genes_.swap(other.genes_);
+			fitness_.swap(other.fitness_);
+			changes_.swap(other.changes_);
+			modified_.swap(other.modified_);
+		}
+	};
+
+}
+
+#endif // !__GENE_MATRIX__
@@ -0,0 +1,143 @@
+/**
+ *	Summary of fitness of evaluated population: best and worst member,
+ *	mean and variance. Environment computes it once per generation and
+ *	passes it to finish conditions, so they don't have to scan population
+ *
+ *	Authors: Michal Swiatek, Michal Sulek
+ *	Update:	 17.10.2026
+ *
+ *	Github repository: https://github.com/MichalKonradSulek/ZPR
+ */
+
+#ifndef __GENERATION_STATS__
+#define __GENERATION_STATS__
+
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <cstdint>
+#include <type_traits>
+
+namespace ga {
+
+	/**
+	 *	@brief	Statistics of fitness of population
+	 *
+	 *	@details Indices refer to population the statistics were computed for and
+	 *			 are valid until population changes. Variance is population variance
+	 */
+	struct GenerationStats
+	{
+		using size_type = size_t;
+
+		uint64_t	generation	= 0;
+		size_type	size		= 0;
+
+		size_type	best_index	= 0;
+		size_type	worst_index	= 0;
+
+		double best		= -std::numeric_limits<double>::infinity();
+		double worst	= std::numeric_limits<double>::infinity();
+		double mean		= 0.0;
+		double variance	= 0.0;
+
+		double getStandardDeviation() const { return std::sqrt(variance); }
+
+		/**
+		 *	@brief	Computes statistics of given population in a single pass
+		 *
+		 *	@details Mean and variance are accumulated with Welford's algorithm,
+		 *			 which is numerically stable for large populations. In case
+		 *			 of ties first best and first worst member are chosen
+		 */
+		template <typename Population>
+		void compute(const Population& population)
+		{
+			accumulate(population.size(), [&population](size_type i) { return population[i].getFitness(); });
+		}
+
+		/**
+		 *	@brief	Computes statistics of fitness column of population
+		 *
+		 *	@param	fitness	Array of fitness of count members
+		 */
+		void compute(const double* fitness, size_type count)
+		{
+			accumulate(count, [fitness](size_type i) { return fitness[i]; });
+		}
+
+	private:
+		template <typename FitnessAccessor>
+		void accumulate(size_type count, FitnessAccessor fitnessOf)
+		{
+			size = count;
+			best_index = worst_index = 0;
+			best = -std::numeric_limits<double>::infinity();
+			worst = std::numeric_limits<double>::infinity();
+			mean = variance = 0.0;
+
+			double squares = 0.0;
+			for (size_type i = 0; i < size; ++i)
+			{
+				double fitness = fitnessOf(i);
+
+				if (fitness > best)
+				{
+					best = fitness;
+					best_index = i;
+				}
+				if (fitness < worst)
+				{
+					worst = fitness;
+					worst_index = i;
+				}
+
+				double delta = fitness - mean;
+				mean += delta / static_cast<double>(i + 1);
+				squares += delta * (fitness - mean);
+			}
+
+			if (size > 0)
+				variance = squares / static_cast<double>(size);
+		}
+	};
+
+	namespace detail {
+
+		template <typename FinishCondition, typename Population, typename = void>
+		struct AcceptsStats : std::false_type { };
+
+		template <typename FinishCondition, typename Population>
+		struct AcceptsStats<FinishCondition, Population,
+			decltype(void(std::declval<FinishCondition&>()(std::declval<const Population&>(), std::declval<const GenerationStats&>())))>
+			: std::true_type { };
+
+		template <typename FinishCondition, typename Population>
+		bool checkFinish(FinishCondition& finishCondition, const Population& population, const GenerationStats& stats, std::true_type)
+		{
+			return finishCondition(population, stats);
+		}
+
+		template <typename FinishCondition, typename Population>
+		bool checkFinish(FinishCondition& finishCondition, const Population& population, const GenerationStats&, std::false_type)
+		{
+			return finishCondition(population);
+		}
+
+	}
+
+	/**
+	 *	@brief	Calls finish condition with statistics when it accepts them
+	 *
+	 *	@details FinishCondition may take either (const Population&) or
+	 *			 (const Population&, const GenerationStats&)
+	 */
+	template <typename FinishCondition, typename Population>
+	bool checkFinish(FinishCondition& finishCondition, const Population& population, const GenerationStats& stats)
+	{
+		return detail::checkFinish(finishCondition, population, stats, detail::AcceptsStats<FinishCondition, Population>());
+	}
+
+}
+
+#endif // !__GENERATION_STATS__
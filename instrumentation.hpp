@@ -0,0 +1,214 @@
+/**
+ *	Per generation measurements of environment: wall time of every
+ *	phase of a generation and counters of evaluations and applied
+ *	genetic operators. Recording is switched on at runtime and can be
+ *	compiled out completely by defining GA_DISABLE_INSTRUMENTATION
+ *
+ *	Authors: Michal Swiatek, Michal Sulek
+ *	Update:	 17.10.2026
+ *
+ *	Github repository: https://github.com/MichalKonradSulek/ZPR
+ */
+
+#ifndef __INSTRUMENTATION__
+#define __INSTRUMENTATION__
+
+#include <vector>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <functional>
+
+namespace ga {
+
+	/**
+	 *	@brief	Measurements of a single generation
+	 *
+	 *	@details Times are given in nanoseconds. allocations is counted only when
+	 *			 allocation counter was set with Instrumentation::setAllocationCounter()
+	 */
+	struct GenerationRecord
+	{
+		uint64_t generation	= 0;
+
+		uint64_t selection_ns		= 0;
+		uint64_t crossover_ns		= 0;
+		uint64_t mutation_ns		= 0;
+		uint64_t local_search_ns	= 0;
+		uint64_t reproduction_ns	= 0;
+		uint64_t evaluation_ns		= 0;
+		uint64_t total_ns			= 0;
+
+		uint64_t evaluations	= 0;
+		uint64_t cache_hits		= 0;
+		uint64_t skipped		= 0;
+		uint64_t crossovers		= 0;
+		uint64_t mutations		= 0;
+		uint64_t local_searches	= 0;
+		uint64_t improvements	= 0;
+		uint64_t allocations	= 0;
+	};
+
+	/**
+	 *	@brief	Collection of GenerationRecords of environment
+	 *
+	 *	@details Disabled by default, when disabled environment doesn't measure
+	 *			 anything and the only cost is a branch per phase. Defining
+	 *			 GA_DISABLE_INSTRUMENTATION removes measurements at compile time
+	 *
+	 *	@note	Records are appended every generation, call reserve() before
+	 *			simulation if recording itself shouldn't allocate
+	 */
+	class Instrumentation
+	{
+	public:
+		using Clock				= std::chrono::steady_clock;
+		using AllocationCounter	= std::function<size_t()>;
+
+		/**
+		 *	@brief	Measures time of a phase and adds it to given field of record
+		 *
+		 *	@details Does nothing when record is nullptr
+		 */
+		class PhaseTimer
+		{
+		private:
+			GenerationRecord*	record_;
+			uint64_t			GenerationRecord::* field_;
+			Clock::time_point	start_;
+
+		public:
+			PhaseTimer(GenerationRecord* record, uint64_t GenerationRecord::* field) : record_(record), field_(field)
+			{
+				if (record_ != nullptr)
+					start_ = Clock::now();
+			}
+
+			~PhaseTimer()
+			{
+				if (record_ != nullptr)
+					record_->*field_ += std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start_).count();
+			}
+
+			PhaseTimer(const PhaseTimer&) = delete;
+			PhaseTimer& operator=(const PhaseTimer&) = delete;
+		};
+
+	private:
+		std::vector<GenerationRecord> records_;
+
+		bool enabled_ = false;
+
+		uint64_t generation_ = 0;
+
+		AllocationCounter allocation_counter_;
+
+	public:
+		static constexpr bool isCompiledIn()
+		{
+#ifdef GA_DISABLE_INSTRUMENTATION
+			return false;
+#else
+			return true;
+#endif
+		}
+
+		void setEnabled(bool enabled) { enabled_ = enabled && isCompiledIn(); }
+		bool isEnabled() const { return isCompiledIn() && enabled_; }
+
+		/**
+		 *	@brief	Sets function returning number of heap allocations made so far
+		 *
+		 *	@details Library doesn't replace allocation functions itself, program
+		 *			 counting its allocations can plug its counter in here
+		 */
+		void setAllocationCounter(AllocationCounter allocation_counter) { allocation_counter_ = std::move(allocation_counter); }
+
+		/**
+		 *	@brief	Starts record of next generation, returns nullptr when disabled
+		 */
+		GenerationRecord* beginGeneration()
+		{
+			if (!isEnabled())
+				return nullptr;
+
+			records_.emplace_back();
+			records_.back().generation = generation_++;
+
+			if (allocation_counter_)
+				records_.back().allocations = allocation_counter_();
+
+			return &records_.back();
+		}
+
+		/**
+		 *	@brief	Completes record started with beginGeneration()
+		 */
+		void endGeneration(GenerationRecord* record)
+		{
+			if (record == nullptr)
+				return;
+
+			if (allocation_counter_)
+				record->allocations = allocation_counter_() - record->allocations;
+		}
+
+		const std::vector<GenerationRecord>& getRecords() const { return records_; }
+
+		void reserve(size_t generations) { records_.reserve(generations); }
+
+		void clear()
+		{
+			records_.clear();
+			generation_ = 0;
+		}
+
+		/**
+		 *	@brief	Writes records as CSV with header line
+		 */
+		void writeCsv(std::ostream& stream) const
+		{
+			stream << "generation,selection_ns,crossover_ns,mutation_ns,local_search_ns,reproduction_ns,evaluation_ns,total_ns,"
+					  "evaluations,cache_hits,skipped,crossovers,mutations,local_searches,improvements,allocations\n";
+
+			for (const auto& record : records_)
+			{
+				stream << record.generation << ','
+					   << record.selection_ns << ',' << record.crossover_ns << ',' << record.mutation_ns << ','
+					   << record.local_search_ns << ',' << record.reproduction_ns << ',' << record.evaluation_ns << ',' << record.total_ns << ','
+					   << record.evaluations << ',' << record.cache_hits << ',' << record.skipped << ','
+					   << record.crossovers << ',' << record.mutations << ','
+					   << record.local_searches << ',' << record.improvements << ',' << record.allocations << '\n';
+			}
+		}
+
+		/**
+		 *	@brief	Writes records as JSON lines, one object per generation
+		 */
+		void writeJsonLines(std::ostream& stream) const
+		{
+			for (const auto& record : records_)
+			{
+				stream << "{\"generation\":" << record.generation
+					   << ",\"selection_ns\":" << record.selection_ns
+					   << ",\"crossover_ns\":" << record.crossover_ns
+					   << ",\"mutation_ns\":" << record.mutation_ns
+					   << ",\"local_search_ns\":" << record.local_search_ns
+					   << ",\"reproduction_ns\":" << record.reproduction_ns
+					   << ",\"evaluation_ns\":" << record.evaluation_ns
+					   << ",\"total_ns\":" << record.total_ns
+					   << ",\"evaluations\":" << record.evaluations
+					   << ",\"cache_hits\":" << record.cache_hits
+					   << ",\"skipped\":" << record.skipped
+					   << ",\"crossovers\":" << record.crossovers
+					   << ",\"mutations\":" << record.mutations
+					   << ",\"local_searches\":" << record.local_searches
+					   << ",\"improvements\":" << record.improvements
+					   << ",\"allocations\":" << record.allocations << "}\n";
+			}
+		}
+	};
+
+}
+
+#endif // !__INSTRUMENTATION__
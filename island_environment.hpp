@@ -0,0 +1,445 @@
+/**
+ *	Class defining island model of genetic algorithm. Several
+ *	environments (islands) evolve their own populations concurrently,
+ *	each on a separate thread, and every few generations best
+ *	individuals migrate between islands along specified topology
+ *
+ *	Authors: Michal Swiatek, Michal Sulek
+ *	Update:	 17.10.2026
+ *
+ *	Github repository: https://github.com/MichalKonradSulek/ZPR
+ */
+
+#ifndef __ISLAND_ENVIRONMENT__
+#define __ISLAND_ENVIRONMENT__
+
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <thread>
+#include <utility>
+#include <algorithm>
+#include <exception>
+
+#include "environment.hpp"
+#include "random.hpp"
+#include "exception.hpp"
+
+namespace ga {
+
+	/**
+	 *	@brief	Topology defining to which islands migrants are sent
+	 *
+	 *	@details Ring			- island i sends migrants to island i + 1
+	 *			 FullyConnected	- island sends migrants to every other island
+	 *			 Random			- every migration picks one random destination island
+	 */
+	enum class MigrationTopology
+	{
+		Ring,
+		FullyConnected,
+		Random
+	};
+
+	/**
+	 *	@brief	Bounded lock-free queue with one producer and one consumer
+	 *
+	 *	@details Storage is allocated once in constructor, elements are copy
+	 *			 assigned into preallocated slots. Neither tryPush() nor tryPop()
+	 *			 ever block - they fail when queue is full or empty
+	 *
+	 *	@tparam	ValueType Type of stored elements
+	 */
+	template <typename ValueType>
+	class MigrationQueue
+	{
+	private:
+		std::vector<ValueType> slots_;
+
+		std::atomic<size_t> head_;
+		std::atomic<size_t> tail_;
+
+	public:
+		explicit MigrationQueue(size_t capacity) : slots_(capacity + 1), head_(0), tail_(0) { }
+
+		MigrationQueue(const MigrationQueue&) = delete;
+		MigrationQueue& operator=(const MigrationQueue&) = delete;
+
+		/**
+		 *	@brief	Called only by producer, returns false if queue is full
+		 */
+		bool tryPush(const ValueType& value)
+		{
+			size_t tail = tail_.load(std::memory_order_relaxed);
+			size_t next = (tail + 1) % slots_.size();
+
+			if (next == head_.load(std::memory_order_acquire))
+				return false;
+
+			slots_[tail] = value;
+			tail_.store(next, std::memory_order_release);
+
+			return true;
+		}
+
+		/**
+		 *	@brief	Called only by consumer, returns false if queue is empty
+		 */
+		bool tryPop(ValueType& value)
+		{
+			size_t head = head_.load(std::memory_order_relaxed);
+
+			if (head == tail_.load(std::memory_order_acquire))
+				return false;
+
+			value = slots_[head];
+			head_.store((head + 1) % slots_.size(), std::memory_order_release);
+
+			return true;
+		}
+	};
+
+	/**
+	 *	@brief	An environment running multiple islands concurrently
+	 *
+	 *	@details Each island is a separate EnvironmentType with its own operators,
+	 *			 population and random number stream, running on its own thread.
+	 *			 Every migration_interval generations each island copies its best
+	 *			 individuals into queues of destination islands and replaces its
+	 *			 worst individuals with migrants waiting in its incoming queues.
+	 *			 Each ordered pair of islands has its own bounded lock-free queue,
+	 *			 so islands never wait for each other - if destination queue is
+	 *			 full, migrant is dropped
+	 *
+	 *	@tparam	SpecimenType	Type of a member of population
+	 *	@tparam	EnvironmentType	Type of single island, Environment or class derived from it
+	 *
+	 *	@note	Fitness function and finish condition are copied for every island and
+	 *			called concurrently from different threads
+	 *	@note	Timing of migrations depends on thread scheduling, so runs with migration
+	 *			are not reproducible even with seeded islands
+	 *
+	 *	@see	Environment
+	 */
+	template <typename SpecimenType, typename EnvironmentType = Environment<SpecimenType> >
+	class IslandEnvironment
+	{
+	public:
+		using size_type = size_t;
+
+		using Gene			= typename SpecimenType::Gene;
+		using Population	= std::vector<SpecimenType>;
+
+	protected:
+		std::vector<std::unique_ptr<EnvironmentType> > islands_;
+
+		//	queues_[from * number_of_islands + to]
+		std::vector<std::unique_ptr<MigrationQueue<SpecimenType> > > queues_;
+
+		size_type			migration_interval_;
+		size_type			migrants_;
+		MigrationTopology	topology_;
+
+	private:
+		void createQueues()
+		{
+			queues_.clear();
+			queues_.reserve(islands_.size() * islands_.size());
+
+			for (size_type i = 0; i < islands_.size() * islands_.size(); ++i)
+				queues_.emplace_back(std::make_unique<MigrationQueue<SpecimenType> >(2 * migrants_));
+		}
+
+		MigrationQueue<SpecimenType>& queue(size_type from, size_type to)
+		{
+			return *queues_[from * islands_.size() + to];
+		}
+
+		void emigrate(size_type island, Random& random)
+		{
+			size_type number_of_islands = islands_.size();
+			if (number_of_islands < 2 || migrants_ == 0)
+				return;
+
+			Population migrants = islands_[island]->getBestSpecimens(migrants_);
+
+			auto send = [this, island, &migrants](size_type destination)
+			{
+				for (const auto& migrant : migrants)
+					queue(island, destination).tryPush(migrant);
+			};
+
+			switch (topology_)
+			{
+			case MigrationTopology::Ring:
+				send((island + 1) % number_of_islands);
+				break;
+
+			case MigrationTopology::FullyConnected:
+				for (size_type destination = 0; destination < number_of_islands; ++destination)
+				{
+					if (destination != island)
+						send(destination);
+				}
+				break;
+
+			case MigrationTopology::Random:
+				send((island + 1 + random.uniform(number_of_islands - 1)) % number_of_islands);
+				break;
+			}
+		}
+
+		void immigrate(size_type island)
+		{
+			Population migrants;
+			SpecimenType migrant;
+
+			for (size_type source = 0; source < islands_.size(); ++source)
+			{
+				if (source == island)
+					continue;
+
+				while (queue(source, island).tryPop(migrant))
+					migrants.push_back(migrant);
+			}
+
+			islands_[island]->acceptMigrants(migrants);
+		}
+
+		template <typename FitnessFunction, typename FinishCondition>
+		void evolveIsland(size_type island, FitnessFunction fitness, FinishCondition finishCondition,
+						  int number_of_generations, std::atomic<bool>& stop, Random random)
+		{
+			EnvironmentType& environment = *islands_[island];
+
+			environment.evaluate(fitness);
+
+			for (int generation = 0; !stop.load(std::memory_order_relaxed); ++generation)
+			{
+				if (checkFinish(finishCondition, environment.getPopulation(), environment.getGenerationStats()))
+				{
+					stop = true;
+					break;
+				}
+
+				if (number_of_generations != -1 && generation >= number_of_generations)
+					break;
+
+				environment.iteration(fitness, false);
+
+				if (migration_interval_ != 0 && (generation + 1) % migration_interval_ == 0)
+				{
+					emigrate(island, random);
+					immigrate(island);
+				}
+			}
+		}
+
+	public:
+		/**
+		 *	@param	number_of_islands		Number of concurrently evolving populations
+		 *	@param	island_population_size	Size of population of every island
+		 *	@param	migration_interval		Number of generations between migrations, 0 disables migration
+		 *	@param	migrants				Number of best individuals sent by island during migration
+		 *	@param	topology				Topology of migration
+		 */
+		explicit IslandEnvironment(size_type			number_of_islands,
+								   size_type			island_population_size,
+								   size_type			migration_interval = 10,
+								   size_type			migrants = 2,
+								   MigrationTopology	topology = MigrationTopology::Ring)
+			: migration_interval_(migration_interval), migrants_(migrants), topology_(topology)
+		{
+			if (number_of_islands == 0)
+				throw Exception("IslandEnvironment requires at least one island");
+
+			//	Every island gets its own non-overlapping random stream
+			Random random(getRandom()());
+
+			islands_.reserve(number_of_islands);
+			for (size_type i = 0; i < number_of_islands; ++i)
+			{
+				RandomBinding binding(random);
+				islands_.emplace_back(std::make_unique<EnvironmentType>(island_population_size));
+				islands_.back()->setRandom(random.split());
+			}
+
+			createQueues();
+		}
+
+		IslandEnvironment(const IslandEnvironment&) = delete;
+		IslandEnvironment& operator=(const IslandEnvironment&) = delete;
+
+		/**
+		 *	@brief	Perform evolution of all islands
+		 *
+		 *	@details Every island runs on its own thread until FinishCondition is met
+		 *			 by population of any island or given number of generations passes
+		 *
+		 *	@tparam FitnessFunction	Functor object taking SpecimenType as an argument and returning
+		 *			it's fitness value converted to double
+		 *	@tparam	FinishCondition	Functor object taking const Population& and optionally
+		 *			const GenerationStats& of island and returning a boolean
+		 *			indicator whether a finish condition is met
+		 *
+		 *	@param	number_of_generations Number of generations of every island, set to -1 to
+		 *			perform evolution until FinishCondition is met
+		 */
+		template <typename FitnessFunction, typename FinishCondition>
+		void runSimulation(FitnessFunction fitness, FinishCondition finishCondition, int number_of_generations = -1)
+		{
+			std::atomic<bool> stop(false);
+
+			std::vector<std::exception_ptr> errors(islands_.size());
+			std::vector<std::thread> threads;
+			threads.reserve(islands_.size());
+
+			//	Streams used to pick destinations of Random topology
+			Random random(islands_.front()->getRandom()());
+
+			for (size_type i = 0; i < islands_.size(); ++i)
+			{
+				threads.emplace_back([this, i, fitness, finishCondition, number_of_generations, &stop, &errors, migration_random = random.split()]()
+				{
+					try
+					{
+						evolveIsland(i, fitness, finishCondition, number_of_generations, stop, migration_random);
+					}
+					catch (...)
+					{
+						errors[i] = std::current_exception();
+						stop = true;
+					}
+				});
+			}
+
+			for (auto& thread : threads)
+				thread.join();
+
+			for (auto& error : errors)
+			{
+				if (error)
+					std::rethrow_exception(error);
+			}
+		}
+
+		/**
+		 *	@brief	Best individual among all islands
+		 */
+		SpecimenType& getBest()
+		{
+			SpecimenType* best = &islands_.front()->getBest();
+
+			for (auto& island : islands_)
+			{
+				SpecimenType& candidate = island->getBest();
+				if (candidate.getFitness() > best->getFitness())
+					best = &candidate;
+			}
+
+			return *best;
+		}
+
+		/**
+		 *	@brief	Sets seed of every island, islands get non-overlapping streams
+		 */
+		void setSeed(uint64_t seed)
+		{
+			Random random(seed);
+
+			for (auto& island : islands_)
+				island->setRandom(random.split());
+		}
+
+		/**
+		 *	@brief	Changes migration settings, can't be called during simulation
+		 */
+		void setMigration(size_type migration_interval, size_type migrants, MigrationTopology topology)
+		{
+			migration_interval_ = migration_interval;
+			migrants_ = migrants;
+			topology_ = topology;
+
+			createQueues();
+		}
+
+		size_type getNumberOfIslands() const { return islands_.size(); }
+
+		EnvironmentType& getIsland(size_type index) { return *islands_[index]; }
+		const EnvironmentType& getIsland(size_type index) const { return *islands_[index]; }
+
+		//	Strategies are constructed separately for every island
+		template <typename MutationType, typename... Args>
+		void setMutationType(const Args&... args)
+		{
+			for (auto& island : islands_)
+				island->template setMutationType<MutationType>(args...);
+		}
+
+		template <typename CrossoverType, typename... Args>
+		void setCrossoverType(const Args&... args)
+		{
+			for (auto& island : islands_)
+				island->template setCrossoverType<CrossoverType>(args...);
+		}
+
+		template <typename SelectionType, typename... Args>
+		void setSelectionType(const Args&... args)
+		{
+			for (auto& island : islands_)
+				island->template setSelectionType<SelectionType>(args...);
+		}
+
+		template <template <typename...> typename MutationType, typename... Args>
+		void setMutationType(const Args&... args)
+		{
+			for (auto& island : islands_)
+				island->template setMutationType<MutationType>(args...);
+		}
+
+		template <template <typename...> typename CrossoverType, typename... Args>
+		void setCrossoverType(const Args&... args)
+		{
+			for (auto& island : islands_)
+				island->template setCrossoverType<CrossoverType>(args...);
+		}
+
+		template <template <typename T> typename SelectionType, typename... Args>
+		void setSelectionType(const Args&... args)
+		{
+			for (auto& island : islands_)
+				island->template setSelectionType<SelectionType>(args...);
+		}
+
+		template <typename LocalSearchType, typename... Args>
+		void setLocalSearchType(const Args&... args)
+		{
+			for (auto& island : islands_)
+				island->template setLocalSearchType<LocalSearchType>(args...);
+		}
+
+		template <template <typename...> typename LocalSearchType, typename... Args>
+		void setLocalSearchType(const Args&... args)
+		{
+			for (auto& island : islands_)
+				island->template setLocalSearchType<LocalSearchType>(args...);
+		}
+
+		template <typename SuccessionType, typename... Args>
+		void setSuccessionType(const Args&... args)
+		{
+			for (auto& island : islands_)
+				island->template setSuccessionType<SuccessionType>(args...);
+		}
+
+		template <template <typename T> typename SuccessionType, typename... Args>
+		void setSuccessionType(const Args&... args)
+		{
+			for (auto& island : islands_)
+				island->template setSuccessionType<SuccessionType>(args...);
+		}
+	};
+
+}
+
+#endif // !__ISLAND_ENVIRONMENT__
@@ -0,0 +1,77 @@
+/**
+ *	Class representing local improvement of a Genotype. Applied to
+ *	offspring after mutation it turns genetic algorithm into memetic
+ *	one: every improved member is a local optimum of its neighbourhood
+ *
+ *	Authors: Michal Swiatek, Michal Sulek
+ *	Update:	 17.10.2026
+ *
+ *	Github repository: https://github.com/MichalKonradSulek/ZPR
+ */
+
+#ifndef __LOCAL_SEARCH__
+#define __LOCAL_SEARCH__
+
+#include <cstdlib>
+#include <vector>
+
+#include "change_set.hpp"
+
+namespace ga {
+
+	/**
+	 *	@brief	Base class representing local search applied to Genotype
+	 *
+	 *	@details Local search is applied after mutation to a fraction of offspring,
+	 *			 members are improved concurrently using executor of environment
+	 *
+	 *	@tparam GeneType	 Type of Gene in Genotype
+	 *	@tparam GenotypeType Container of Genes, by default std::vector<GeneType>
+	 *
+	 *	@note	bool improve(Genotype& genes) must be overriden
+	 *	@note	improve() is called concurrently from multiple threads, so it has to
+	 *			be thread safe (scratch buffers should be thread_local)
+	 *
+	 *	@see	Environment::setLocalSearchType
+	 */
+	template <typename GeneType, typename GenotypeType = std::vector<GeneType> >
+	class LocalSearch
+	{
+	public:
+		using Gene = GeneType;
+		using Genotype = GenotypeType;
+		using Changes = typename ChangeSetOf<Gene, Genotype>::type;
+
+		virtual ~LocalSearch() = default;
+
+		/**
+		 *	@brief	Improves Genotype
+		 *
+		 *	@return	True if Genotype was modified
+		 *
+		 *	@note	This method has to be overriden
+		 */
+		virtual bool improve(Genotype& genes) = 0;
+
+		/**
+		 *	@brief	Improves Genotype recording modified genes in change set
+		 *
+		 *	@details Change set contains genes modified since last evaluation, so it
+		 *			 can be used to limit search to neighbourhood of changes. By default
+		 *			 calls improve() and marks whole Genotype as modified
+		 *
+		 *	@return	True if Genotype was modified
+		 */
+		virtual bool improveTracked(Genotype& genes, Changes& changes)
+		{
+			if (!improve(genes))
+				return false;
+
+			changes.markAll();
+			return true;
+		}
+	};
+
+}
+
+#endif // !__LOCAL_SEARCH__
@@ -0,0 +1,463 @@
+/**
+ *	Class defining environment evolving population of fixed length
+ *	Genotypes stored in gene matrices. Parents are copied row by row
+ *	between two preallocated populations, so after first generation
+ *	evolution doesn't allocate memory
+ *
+ *	Authors: Michal Swiatek, Michal Sulek
+ *	Update:	 17.10.2026
+ *
+ *	Github repository: https://github.com/MichalKonradSulek/ZPR
+ */
+
+#ifndef __MATRIX_ENVIRONMENT__
+#define __MATRIX_ENVIRONMENT__
+
+#include <vector>
+#include <memory>
+#include <functional>
+#include <type_traits>
+
+#include "gene_matrix.hpp"
+#include "fitness.hpp"
+
+#include "mutation.hpp"
+#include "crossover.hpp"
+#include "selection.hpp"
+
+#include "Predefined/mutations.hpp"
+#include "Predefined/crossovers.hpp"
+#include "Predefined/selections.hpp"
+
+#include "random.hpp"
+#include "executor.hpp"
+#include "generation_stats.hpp"
+
+namespace ga {
+
+	/**
+	 *	@brief	An environment evolving MatrixPopulation
+	 *
+	 *	@details Alternative to Environment for problems with Genotypes of equal,
+	 *			 fixed length (e.g. permutations of cities, vectors of parameters).
+	 *			 Population and offspring are two MatrixPopulations allocated at
+	 *			 construction: selection picks parents from fitness column, their rows
+	 *			 are copied into offspring, which is crossed, mutated, evaluated and
+	 *			 swapped with population. Genetic operators are instantiated with
+	 *			 Genotype GeneRow<Gene>, e.g. setMutationType<SwapGeneMutation>(), and
+	 *			 selections with MatrixSpecimen<Gene>. Stages run in parallel with
+	 *			 executor of environment, every member (pair of members) drawing
+	 *			 random numbers from its own stream, like in Environment
+	 *
+	 *	@tparam	GeneType Trivially copyable type of Gene
+	 *
+	 *	@note	Fitness functions take const MatrixSpecimen<Gene>&, DeltaFitness and
+	 *			BatchFitness of MatrixSpecimen<Gene> are supported
+	 *
+	 *	@see	MatrixPopulation
+	 *	@see	Environment
+	 */
+	template <typename GeneType>
+	class MatrixEnvironment
+	{
+	public:
+		using size_type		= size_t;
+
+		using Gene			= GeneType;
+		using Genotype		= GeneRow<GeneType>;
+		using Member		= MatrixSpecimen<GeneType>;
+		using Population	= MatrixPopulation<GeneType>;
+		using Indices		= typename Selection<Member>::Indices;
+
+	protected:
+		Population population_;
+		Population offspring_;
+
+		Indices parent_indices_;
+
+		//	Indices of modified members evaluated in current generation
+		std::vector<size_type> pending_;
+
+		//	Views of evaluated members passed to BatchFitness
+		std::vector<Member> batch_views_;
+
+		std::unique_ptr<Mutation<Gene, Genotype>>	mutation_type_;
+		std::unique_ptr<Crossover<Gene, Genotype>>	crossover_type_;
+		std::unique_ptr<FitnessSelection<Member>>	selection_type_;
+
+		std::unique_ptr<Executor>	executor_;
+
+		Random random_;
+
+		GenerationStats		stats_;
+		bool				stats_valid_ = false;
+
+		void updateStatistics()
+		{
+			stats_.compute(population_.getFitnessColumn().data(), population_.size());
+			stats_valid_ = true;
+		}
+
+		/**
+		 *	@brief	Copies rows of parents picked from fitness column into offspring_
+		 */
+		void selection()
+		{
+			const std::vector<double>& fitness = population_.getFitnessColumn();
+			selection_type_->selectFromFitness(fitness.data(), fitness.size(), population_.size(), parent_indices_);
+
+			for (size_type i = 0; i < parent_indices_.size(); ++i)
+				offspring_.copyMember(i, population_, parent_indices_[i]);
+		}
+
+		/**
+		 *	@brief	Crosses adjacent members of offspring_ in place
+		 */
+		void crossover(Executor& executor)
+		{
+			RandomStreams streams = stageStreams();
+
+			//	Passed by reference, copying body into Executor::Task would allocate
+			auto body = [this, streams](size_type begin, size_type end)
+			{
+				Random random;
+				RandomBinding binding(random);
+
+				for (size_type pair = begin; pair < end; ++pair)
+				{
+					streams.seed(random, pair);
+
+					Member parentA = offspring_[2 * pair];
+					Member parentB = offspring_[2 * pair + 1];
+
+					if (crossover_type_->crossTracked(parentA.getTrackedGenotype(), parentB.getTrackedGenotype(), parentA.getChanges(), parentB.getChanges()))
+					{
+						parentA.markModified();
+						parentB.markModified();
+					}
+				}
+			};
+			executor.parallelFor(0, offspring_.size() / 2, std::cref(body));
+		}
+
+		void mutation(Executor& executor)
+		{
+			RandomStreams streams = stageStreams();
+
+			auto body = [this, streams](size_type begin, size_type end)
+			{
+				Random random;
+				RandomBinding binding(random);
+
+				for (size_type i = begin; i < end; ++i)
+				{
+					streams.seed(random, i);
+
+					Member individual = offspring_[i];
+					if (mutation_type_->mutateTracked(individual.getTrackedGenotype(), individual.getChanges()))
+						individual.markModified();
+				}
+			};
+			executor.parallelFor(0, offspring_.size(), std::cref(body));
+		}
+
+		RandomStreams stageStreams()
+		{
+			return RandomStreams(ga::getRandom()(), stats_.generation);
+		}
+
+		/**
+		 *	@brief	Evaluates modified members of given population using given executor
+		 *
+		 *	@details Unmodified members (e.g. parents copied without crossover and
+		 *			 mutation) keep their fitness. FitnessFunction derived from DeltaFitness evaluates members with
+		 *			 recorded changes incrementally, BatchFitness receives chunks of
+		 *			 population and writes their fitness directly into fitness column
+		 */
+		template <typename FitnessFunction>
+		void evaluation(Population& population, FitnessFunction& fitness, Executor& executor)
+		{
+			using IsBatch = std::is_base_of<BatchFitness<Member>, FitnessFunction>;
+			using IsDelta = std::integral_constant<bool, std::is_base_of<DeltaFitness<Member>, FitnessFunction>::value && !IsBatch::value>;
+
+			pending_.clear();
+			for (size_type i = 0; i < population.size(); ++i)
+			{
+				if (population[i].isModified())
+					pending_.push_back(i);
+			}
+
+			evaluatePending(population, fitness, executor, IsDelta(), IsBatch());
+		}
+
+		//	Evaluates members of population listed in pending_
+		template <typename FitnessFunction, typename IsDelta>
+		void evaluatePending(Population& population, FitnessFunction& fitness, Executor& executor, IsDelta is_delta, std::false_type)
+		{
+			auto body = [this, &population, &fitness, is_delta](size_type begin, size_type end)
+			{
+				for (size_type i = begin; i < end; ++i)
+				{
+					Member member = population[pending_[i]];
+					finishEvaluation(member, evaluateMember(fitness, member, is_delta), is_delta);
+				}
+			};
+			executor.parallelFor(0, pending_.size(), std::cref(body));
+		}
+
+		template <typename FitnessFunction, typename IsDelta>
+		void evaluatePending(Population& population, FitnessFunction& fitness, Executor& executor, IsDelta, std::true_type)
+		{
+			batch_views_.clear();
+			for (size_type index : pending_)
+				batch_views_.push_back(population[index]);
+
+			auto body = [this, &population, &fitness](size_type begin, size_type end)
+			{
+				//	Pending indices are sorted, every run of consecutive members is one batch
+				for (size_type first = begin, last; first < end; first = last)
+				{
+					for (last = first + 1; last < end && pending_[last] == pending_[last - 1] + 1; ++last);
+
+					fitness.evaluateBatch(batch_views_.data() + first, last - first, population.getFitnessData() + pending_[first]);
+				}
+
+				for (size_type i = begin; i < end; ++i)
+					finishEvaluation(batch_views_[i], batch_views_[i].getFitness(), std::false_type());
+			};
+			executor.parallelFor(0, pending_.size(), std::cref(body));
+		}
+
+		template <typename FitnessFunction>
+		static double evaluateMember(FitnessFunction& fitness, Member& member, std::false_type)
+		{
+			return fitness(member);
+		}
+
+		template <typename FitnessFunction>
+		static double evaluateMember(FitnessFunction& fitness, Member& member, std::true_type)
+		{
+			double result;
+			if (member.getChanges().isFull() || !fitness.evaluateDelta(member, member.getFitness(), member.getChanges(), result))
+				result = fitness(member);
+
+			return result;
+		}
+
+		//	Without DeltaFitness change sets are left full, so operators don't record changes nobody reads
+		static void finishEvaluation(Member& member, double fitness, std::false_type)
+		{
+			member.setFitness(fitness);
+			member.getChanges().markAll();
+			member.markEvaluated();
+		}
+
+		static void finishEvaluation(Member& member, double fitness, std::true_type)
+		{
+			member.setFitness(fitness);
+			member.getChanges().clear();
+			member.markEvaluated();
+		}
+
+	public:
+		/**
+		 *	@brief	Creates population of given size with Genotypes of given length
+		 *
+		 *	@details Genes are value initialized, use generatePopulation() to
+		 *			 initialize them
+		 */
+		MatrixEnvironment(size_type population_size, size_type genome_length)
+			: population_(population_size, genome_length), offspring_(population_size, genome_length), random_(ga::getRandom()())
+		{
+			parent_indices_.reserve(population_size);
+			pending_.reserve(population_size);
+			batch_views_.reserve(population_size);
+
+			mutation_type_ = std::make_unique<SwapGeneMutation<Gene, Genotype> >();
+			crossover_type_ = std::make_unique<SinglePointCrossover<Gene, Genotype> >();
+			selection_type_ = std::make_unique<RouletteWheelSelection<Member> >();
+
+			executor_ = std::make_unique<SequentialExecutor>();
+		}
+
+		/**
+		 *	@brief	Initializes Genotype of every member with given generator
+		 *
+		 *	@details Generator is called with Genotype& of consecutive members, random
+		 *			 numbers drawn from ga::getRandom() come from generator of environment
+		 */
+		template <typename Generator>
+		void generatePopulation(Generator generator)
+		{
+			RandomBinding binding(random_);
+
+			for (size_type i = 0; i < population_.size(); ++i)
+			{
+				Member member = population_[i];
+				generator(member.getGenotype());
+			}
+
+			stats_ = GenerationStats();
+			stats_valid_ = false;
+		}
+
+		/**
+		 *	@brief	Evolve by one generation
+		 *
+		 *	@details Current population has to be evaluated (see evaluate())
+		 *
+		 *	@tparam	FitnessFunction	Functor object taking const MatrixSpecimen<Gene>& and
+		 *			returning it's fitness value converted to double
+		 *
+		 *	@param	show_best			 Calls print() on best individual of generation
+		 */
+		template <typename FitnessFunction>
+		void iteration(FitnessFunction fitness, bool show_best = true)
+		{
+			RandomBinding binding(random_);
+			Executor& executor = *executor_;
+
+			selection();
+			crossover(executor);
+			mutation(executor);
+			evaluation(offspring_, fitness, executor);
+
+			population_.swap(offspring_);
+
+			++stats_.generation;
+			updateStatistics();
+
+			if (show_best)
+				getBest().print();
+		}
+
+		/**
+		 *	@brief	Perform evolution with given number of generation steps
+		 *
+		 *	@tparam	FinishCondition	Functor object taking const MatrixPopulation<Gene>& and
+		 *			optionally const GenerationStats& and returning a boolean indicator
+		 *			whether a finish condition is met
+		 *
+		 *	@param	number_of_iterations Specifies a number of generations steps, set to -1 to
+		 *			perform evolution until FinishCondition is met
+		 *	@param	show_best			 Calls print() on best individual of generation
+		 *
+		 *	@see	Environment::runSimulation
+		 */
+		template <typename FitnessFunction, typename FinishCondition>
+		void runSimulation(FitnessFunction fitness, FinishCondition finishCondition, int number_of_iterations = -1, bool show_best = true)
+		{
+			evaluate(fitness);
+
+			while (!checkFinish(finishCondition, population_, stats_) && (number_of_iterations == -1 || --number_of_iterations >= 0))
+				iteration(fitness, show_best);
+		}
+
+		/**
+		 *	@brief	Evaluates current population without evolving it
+		 */
+		template <typename FitnessFunction>
+		void evaluate(FitnessFunction fitness)
+		{
+			RandomBinding binding(random_);
+
+			evaluation(population_, fitness, *executor_);
+			updateStatistics();
+		}
+
+		/**
+		 *	@brief	View of best member of population, valid until next iteration
+		 */
+		Member getBest()
+		{
+			if (!stats_valid_)
+				updateStatistics();
+
+			return population_[stats_.best_index];
+		}
+
+		void setSeed(uint64_t seed)
+		{
+			random_.setSeed(seed);
+		}
+
+		Random& getRandom()
+		{
+			return random_;
+		}
+
+		const Population& getPopulation() const
+		{
+			return population_;
+		}
+
+		const GenerationStats& getGenerationStats() const
+		{
+			return stats_;
+		}
+
+		/**
+		 *	@brief	Fitness of current population, element i is fitness of member i
+		 */
+		const std::vector<double>& getFitnessColumn() const
+		{
+			return population_.getFitnessColumn();
+		}
+
+		template <typename MutationType, typename... Args>
+		void setMutationType(Args&&... args)
+		{
+			mutation_type_ = std::make_unique<MutationType>(std::forward<Args>(args)...);
+		}
+
+		template <typename CrossoverType, typename... Args>
+		void setCrossoverType(Args&&... args)
+		{
+			crossover_type_ = std::make_unique<CrossoverType>(std::forward<Args>(args)...);
+		}
+
+		template <typename SelectionType, typename... Args>
+		void setSelectionType(Args&&... args)
+		{
+			selection_type_ = std::make_unique<SelectionType>(std::forward<Args>(args)...);
+		}
+
+		//	Generic function templates taking a specified strategy, instantiated with Gene and GeneRow
+		template <template <typename...> typename MutationType, typename... Args>
+		void setMutationType(Args&&... args)
+		{
+			mutation_type_ = std::make_unique<MutationType<Gene, Genotype> >(std::forward<Args>(args)...);
+		}
+
+		template <template <typename...> typename CrossoverType, typename... Args>
+		void setCrossoverType(Args&&... args)
+		{
+			crossover_type_ = std::make_unique<CrossoverType<Gene, Genotype> >(std::forward<Args>(args)...);
+		}
+
+		template <template <typename T> typename SelectionType, typename... Args>
+		void setSelectionType(Args&&... args)
+		{
+			selection_type_ = std::make_unique<SelectionType<Member> >(std::forward<Args>(args)...);
+		}
+
+		/**
+		 *	@brief	Sets executor used by genetic operators and evaluation
+		 *
+		 *	@see	Environment::setExecutor
+		 */
+		template <typename ExecutorType, typename... Args>
+		void setExecutor(Args&&... args)
+		{
+			executor_ = std::make_unique<ExecutorType>(std::forward<Args>(args)...);
+		}
+
+		Executor& getExecutor() const
+		{
+			return *executor_;
+		}
+	};
+
+}
+
+#endif // !__MATRIX_ENVIRONMENT__
@@ -13,9 +13,12 @@
 #ifndef __MUTATION__
 #define __MUTATION__
 
+#include <cmath>
 #include <cstdlib>
 #include <vector>
 
+#include "random.hpp"
+#include "change_set.hpp"
 #include "exception.hpp"
 
 namespace ga {
@@ -33,19 +36,25 @@ namespace ga {
 	 *			 diversity, it is applied after crossover on meating pool
 	 *
 	 *	@note	void mutate(Genotype& genes) must be overriden
+	 *	@note	Environment mutates members concurrently, so mutate() has to be thread safe
+	 *	@note	Environment mutates trough mutateTracked(), which by default checks mutation
+	 *			condition and calls performTrackedMutation(). Classes overriding mutate()
+	 *			have to override overridesMutate() too, so that their mutate() is used
 	 *
-	 *	@tparam GeneType Type of Gene that mutation will affect
+	 *	@tparam GeneType	 Type of Gene that mutation will affect
+	 *	@tparam GenotypeType Container of Genes, by default std::vector<GeneType>
 	 *
 	 *	@see	GA::Specimen
 	 *	@see	GA::Crossover
 	 *	@see	GA::Selection
 	 */
-	template <typename GeneType>
+	template <typename GeneType, typename GenotypeType = std::vector<GeneType> >
 	class Mutation
 	{
 	public:
 		using Gene = GeneType;
-		using Genotype = std::vector<Gene>;
+		using Genotype = GenotypeType;
+		using Changes = typename ChangeSetOf<Gene, Genotype>::type;
 
 	private:
 		int mutation_chance_;
@@ -56,11 +65,11 @@ namespace ga {
 		 *
 		 *	@details By default it checks if a randomly picked number is lower
 		 *		     than mutation_chance, override this function to change
-		 *			 mutation criteria
+		 *			 mutation criteria. Random numbers should be drawn from getRandom()
 		 */
         virtual bool mutationCondition() const
         {
-            int chance = rand() % MAX_MUTATION_CHANCE;
+            int chance = int(getRandom().uniform(MAX_MUTATION_CHANCE));
             return chance < mutation_chance_;
         }
 
@@ -71,6 +80,44 @@ namespace ga {
 		 */
 		virtual void performMutation(Genotype& genes) const = 0;
 
+		/**
+		 *	@brief	Performs mutation recording modified genes in change set
+		 *
+		 *	@details By default calls performMutation() and marks whole Genotype
+		 *			 as modified. Override it together with performMutation() to allow
+		 *			 incremental evaluation of mutated Specimens
+		 *
+		 *	@see	DeltaFitness
+		 */
+		virtual void performTrackedMutation(Genotype& genes, Changes& changes) const
+		{
+			performMutation(genes);
+			changes.markAll();
+		}
+
+		/**
+		 *	@brief	Checks mutation condition and if successful calls performTrackedMutation()
+		 *
+		 *	@return	True if Genotype could have been modified
+		 */
+		bool trackedMutation(Genotype& genes, Changes& changes) const
+		{
+			if (!mutationCondition())
+				return false;
+
+			performTrackedMutation(genes, changes);
+			return true;
+		}
+
+		/**
+		 *	@brief	Opt-in for classes overriding mutate()
+		 *
+		 *	@details Return true from it to make mutateTracked() call overriden mutate()
+		 *			 and treat whole Genotype as modified, otherwise mutate() is skipped
+		 *			 by environment
+		 */
+		virtual bool overridesMutate() const { return false; }
+
 	public:
 		explicit Mutation(int mutation_chance = MUTATION_CHANCE_PERCENT) : mutation_chance_(mutation_chance) { }
 		virtual ~Mutation() = default;
@@ -84,6 +131,26 @@ namespace ga {
 				performMutation(genes);
 		}
 
+		/**
+		 *	@brief	Mutation recording modified genes in change set
+		 *
+		 *	@details By default calls trackedMutation(), so Genotype is left unmodified
+		 *			 when mutation condition fails. When overridesMutate() returns true
+		 *			 calls mutate() and marks whole Genotype as modified instead
+		 *
+		 *	@return	True if Genotype could have been modified
+		 */
+		virtual bool mutateTracked(Genotype& genes, Changes& changes) const
+		{
+			if (!overridesMutate())
+				return trackedMutation(genes, changes);
+
+			mutate(genes);
+			changes.markAll();
+
+			return true;
+		}
+
 		inline int getMutationChance() const { return mutation_chance_; }
 
 		/**
@@ -99,17 +166,45 @@ namespace ga {
 	 *	@details Override mutateOnce() to change mutation behaviour or
 	 *			 mutatate() to change change criteria of multiple mutation
 	 *
-	 *	@tparam	GeneType Type of Gene that mutation will affect
+	 *	@tparam	GeneType	 Type of Gene that mutation will affect
+	 *	@tparam GenotypeType Container of Genes, by default std::vector<GeneType>
 	 */
-	template <typename GeneType>
-	class MultipleMutation : public Mutation<GeneType>
+	template <typename GeneType, typename GenotypeType = std::vector<GeneType> >
+	class MultipleMutation : public Mutation<GeneType, GenotypeType>
 	{
 	public:
-	    using Genotype = typename Mutation<GeneType>::Genotype;
+	    using Genotype = typename Mutation<GeneType, GenotypeType>::Genotype;
+	    using Changes = typename Mutation<GeneType, GenotypeType>::Changes;
 
 	protected:
 		virtual void performMutation(Genotype& genes) const = 0;
 
+		//	Calls performMutation() or performTrackedMutation() according to criteria of multiple mutation
+		//	Returns true if at least one mutation occured
+		template <typename Perform>
+		bool repeatMutation(Perform perform) const
+		{
+			if (max_mutations_ == -1)
+			{
+				for (int i = 0; i < mutation_iterations_; ++i)
+					perform();
+
+				return mutation_iterations_ > 0;
+			}
+
+			int mutations_occured = 0;
+			for (int i = 0; i < mutation_iterations_ && mutations_occured < max_mutations_; ++i)
+			{
+				if (Mutation<GeneType, GenotypeType>::mutationCondition())
+				{
+					perform();
+					++mutations_occured;
+				}
+			}
+
+			return mutations_occured > 0;
+		}
+
 	protected:
 		int max_mutations_;
 		int mutation_iterations_;
@@ -124,7 +219,7 @@ namespace ga {
 		 *	@param	mutation_iterations	Number of iterations of mutation per mutate() call
 		 *	@param	max_mutations		Number of maximum mutations per mutate() call
 		 */
-		explicit MultipleMutation(int mutation_chance = MUTATION_CHANCE_PERCENT, int mutation_iterations = 1, int max_mutations = -1) : Mutation<GeneType>(mutation_chance), mutation_iterations_(mutation_iterations), max_mutations_(max_mutations) { }
+		explicit MultipleMutation(int mutation_chance = MUTATION_CHANCE_PERCENT, int mutation_iterations = 1, int max_mutations = -1) : Mutation<GeneType, GenotypeType>(mutation_chance), mutation_iterations_(mutation_iterations), max_mutations_(max_mutations) { }
 		~MultipleMutation() = default;
 
 		/**
@@ -132,24 +227,146 @@ namespace ga {
 		 */
 		void mutate(Genotype& genes) const override
 		{
-			if (max_mutations_ == -1)
+			repeatMutation([this, &genes]() { performMutation(genes); });
+		}
+
+		/**
+		 *	@brief	Multiple mutation calling performTrackedMutation()
+		 *
+		 *	@return	True if at least one mutation occured
+		 */
+		bool mutateTracked(Genotype& genes, Changes& changes) const override
+		{
+			if (this->overridesMutate())
+				return Mutation<GeneType, GenotypeType>::mutateTracked(genes, changes);
+
+			return repeatTrackedMutation(genes, changes);
+		}
+
+	protected:
+		/**
+		 *	@brief	Multiple mutation calling performTrackedMutation()
+		 */
+		bool repeatTrackedMutation(Genotype& genes, Changes& changes) const
+		{
+			return repeatMutation([this, &genes, &changes]() { this->performTrackedMutation(genes, changes); });
+		}
+	};
+
+	/**
+	 *	@brief	Helper class mutating every Gene independently with given propability
+	 *
+	 *	@details Instead of drawing a random number per Gene, distance to the next
+	 *			 mutated Gene is drawn from geometric distribution, so cost of
+	 *			 mutation is proportional to number of mutated Genes, not to length
+	 *			 of Genotype. Override mutateGene() to define mutation of single Gene
+	 *
+	 *	@tparam	GeneType	 Type of Gene that mutation will affect
+	 *	@tparam GenotypeType Container of Genes, by default std::vector<GeneType>
+	 */
+	template <typename GeneType, typename GenotypeType = std::vector<GeneType> >
+	class PerGeneMutation : public Mutation<GeneType, GenotypeType>
+	{
+	public:
+		using Gene = typename Mutation<GeneType, GenotypeType>::Gene;
+		using Genotype = typename Mutation<GeneType, GenotypeType>::Genotype;
+		using Changes = typename Mutation<GeneType, GenotypeType>::Changes;
+
+	private:
+		double gene_mutation_rate_;
+
+		//	log(1 - gene_mutation_rate_), precomputed for sampling
+		double log_complement_;
+
+	protected:
+		/**
+		 *	@brief	Mutates Gene at given position
+		 *
+		 *	@note	Must be overriden
+		 */
+		virtual void mutateGene(Genotype& genes, size_t position) const = 0;
+
+		/**
+		 *	@brief	Number of Genes skipped before next mutated one
+		 *
+		 *	@details Returns bound when next mutated Gene lies beyond it
+		 */
+		size_t skipGenes(size_t bound) const
+		{
+			if (gene_mutation_rate_ >= 1.0)
+				return 0;
+
+			if (gene_mutation_rate_ <= 0.0)
+				return bound;
+
+			//	Uniform number from (0, 1], so logarithm is finite
+			double uniform = 1.0 - getRandom().uniformReal();
+			double skip = std::floor(std::log(uniform) / log_complement_);
+
+			return skip >= static_cast<double>(bound) ? bound : static_cast<size_t>(skip);
+		}
+
+		template <typename Mutate>
+		bool mutateGenes(Genotype& genes, Mutate mutate) const
+		{
+			bool mutated = false;
+
+			size_t size = genes.size();
+			for (size_t position = skipGenes(size); position < size; position += 1 + skipGenes(size - position - 1))
 			{
-				for (int i = 0; i < mutation_iterations_; ++i)
-					performMutation(genes);
+				mutate(position);
+				mutated = true;
 			}
-			else
+
+			return mutated;
+		}
+
+		void performMutation(Genotype& genes) const override
+		{
+			mutateGenes(genes, [this, &genes](size_t position) { mutateGene(genes, position); });
+		}
+
+		bool mutateTrackedGenes(Genotype& genes, Changes& changes) const
+		{
+			return mutateGenes(genes, [this, &genes, &changes](size_t position)
 			{
-				for (int i = 0, mutations_occured = 0; i < mutation_iterations_ && mutations_occured < max_mutations_; ++i)
-				{
-					if (Mutation<GeneType>::mutationCondition())
-					{
-						performMutation(genes);
-						++mutations_occured;
-					}
-				}
-			}
+				changes.record(genes, position);
+				mutateGene(genes, position);
+			});
+		}
+
+		void performTrackedMutation(Genotype& genes, Changes& changes) const override
+		{
+			mutateTrackedGenes(genes, changes);
+		}
+
+	public:
+		/**
+		 *	@param	gene_mutation_rate	Propability of mutation of every Gene
+		 *	@param	mutation_chance		Chance that Genotype is mutated at all
+		 */
+		explicit PerGeneMutation(double gene_mutation_rate, int mutation_chance = MAX_MUTATION_CHANCE)
+			: Mutation<GeneType, GenotypeType>(mutation_chance)
+		{
+			setGeneMutationRate(gene_mutation_rate);
+		}
+
+		bool mutateTracked(Genotype& genes, Changes& changes) const override
+		{
+			if (this->overridesMutate())
+				return Mutation<GeneType, GenotypeType>::mutateTracked(genes, changes);
+
+			//	Genotype is modified only if at least one Gene was mutated
+			return this->mutationCondition() && mutateTrackedGenes(genes, changes);
+		}
+
+		double getGeneMutationRate() const { return gene_mutation_rate_; }
+
+		void setGeneMutationRate(double gene_mutation_rate)
+		{
+			gene_mutation_rate_ = gene_mutation_rate;
+			log_complement_ = gene_mutation_rate > 0.0 && gene_mutation_rate < 1.0 ? std::log1p(-gene_mutation_rate) : 0.0;
 		}
-		
 	};
 
 }
@@ -0,0 +1,283 @@
+/**
+ *	Random number generation used by genetic operators. Every thread
+ *	draws numbers from its own stream, so operators can run in parallel
+ *	without contention, and environment binds its own seeded stream
+ *	while it evolves population, so runs are reproducible from one seed
+ *
+ *	Authors: Michal Swiatek, Michal Sulek
+ *	Update:	 17.10.2026
+ *
+ *	Github repository: https://github.com/MichalKonradSulek/ZPR
+ */
+
+#ifndef __RANDOM__
+#define __RANDOM__
+
+#include <cstdint>
+#include <limits>
+#include <random>
+
+namespace ga {
+
+	namespace detail {
+
+		const uint64_t SPLITMIX_INCREMENT = 0x9E3779B97F4A7C15ULL;
+
+		//	splitmix64 output for given counter, consecutive counters give unrelated outputs
+		inline uint64_t splitmix(uint64_t x)
+		{
+			uint64_t z = x + SPLITMIX_INCREMENT;
+			z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+			z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+			return z ^ (z >> 31);
+		}
+
+	}
+
+	/**
+	 *	@brief	Pseudo random number generator (xoshiro256**)
+	 *
+	 *	@details Fast generator with 256 bit state, seeded with splitmix64.
+	 *			 Satisfies UniformRandomBitGenerator, so it can be used with
+	 *			 standard distributions and algorithms (e.g. std::shuffle).
+	 *			 jump() advances stream by 2^128 numbers, so streams created
+	 *			 with split() never overlap
+	 */
+	class Random
+	{
+	public:
+		using result_type = uint64_t;
+
+		static const uint64_t DEFAULT_SEED = 0x853C49E6748FEA9BULL;
+
+	private:
+		uint64_t state_[4];
+
+		static inline uint64_t rotl(uint64_t x, int k)
+		{
+			return (x << k) | (x >> (64 - k));
+		}
+
+	public:
+		explicit Random(uint64_t seed = DEFAULT_SEED) { setSeed(seed); }
+
+		/**
+		 *	@brief	Seeds generator, equal seeds produce equal sequences
+		 */
+		void setSeed(uint64_t seed)
+		{
+			//	splitmix64 spreads seed over whole state
+			for (auto& word : state_)
+			{
+				word = detail::splitmix(seed);
+				seed += detail::SPLITMIX_INCREMENT;
+			}
+		}
+
+		static constexpr result_type min() { return 0; }
+		static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+		inline result_type operator()()
+		{
+			const uint64_t result = rotl(state_[1] * 5, 7) * 9;
+			const uint64_t t = state_[1] << 17;
+
+			state_[2] ^= state_[0];
+			state_[3] ^= state_[1];
+			state_[1] ^= state_[2];
+			state_[0] ^= state_[3];
+
+			state_[2] ^= t;
+			state_[3] = rotl(state_[3], 45);
+
+			return result;
+		}
+
+		/**
+		 *	@brief	Advances generator by 2^128 numbers
+		 */
+		void jump()
+		{
+			static const uint64_t JUMP[] = { 0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL, 0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL };
+
+			uint64_t state[4] = { 0, 0, 0, 0 };
+			for (auto jump : JUMP)
+			{
+				for (int bit = 0; bit < 64; ++bit)
+				{
+					if (jump & (1ULL << bit))
+					{
+						for (int i = 0; i < 4; ++i)
+							state[i] ^= state_[i];
+					}
+					(*this)();
+				}
+			}
+
+			for (int i = 0; i < 4; ++i)
+				state_[i] = state[i];
+		}
+
+		/**
+		 *	@brief	Creates independent substream
+		 *
+		 *	@details Returned generator continues current sequence, while this
+		 *			 generator jumps 2^128 numbers ahead
+		 */
+		Random split()
+		{
+			Random stream(*this);
+			jump();
+
+			return stream;
+		}
+
+		/**
+		 *	@brief	Uniformly distributed integer from range [0, bound), without modulo bias, 0 for bound 0
+		 */
+		inline uint64_t uniform(uint64_t bound)
+		{
+			if (bound == 0)
+				return 0;
+
+#ifdef __SIZEOF_INT128__
+			//	Lemire's multiply and reject method, __extension__ keeps pedantic builds quiet
+			__extension__ typedef unsigned __int128 uint128;
+
+			uint128 product = (uint128)(*this)() * bound;
+			uint64_t low = uint64_t(product);
+
+			if (low < bound)
+			{
+				const uint64_t threshold = (0 - bound) % bound;
+				while (low < threshold)
+				{
+					product = (uint128)(*this)() * bound;
+					low = uint64_t(product);
+				}
+			}
+
+			return uint64_t(product >> 64);
+#else
+			const uint64_t threshold = (0 - bound) % bound;
+
+			uint64_t value = (*this)();
+			while (value < threshold)
+				value = (*this)();
+
+			return value % bound;
+#endif
+		}
+
+		/**
+		 *	@brief	Uniformly distributed double from range [0, 1)
+		 */
+		inline double uniformReal()
+		{
+			return ((*this)() >> 11) * (1.0 / 9007199254740992.0);
+		}
+
+		/**
+		 *	@brief	Returns true with given propability
+		 */
+		inline bool chance(double propability)
+		{
+			return uniformReal() < propability;
+		}
+	};
+
+	/**
+	 *	@brief	Family of random streams of work items processed in parallel
+	 *
+	 *	@details Stream of an item depends only on seed, generation and index of
+	 *			 the item, so items drawing numbers from their own streams give
+	 *			 equal results regardless of how they are distributed between
+	 *			 threads. Generator of item i is seeded with splitmix64 counter
+	 *			 key + 4i, so states of different items never repeat
+	 */
+	class RandomStreams
+	{
+	private:
+		uint64_t key_;
+
+	public:
+		RandomStreams(uint64_t seed, uint64_t generation) : key_(detail::splitmix(seed ^ detail::splitmix(generation))) { }
+
+		/**
+		 *	@brief	Reseeds given generator with stream of item, cheaper than constructing new one
+		 */
+		void seed(Random& random, uint64_t index) const
+		{
+			random.setSeed(key_ + index * (4 * detail::SPLITMIX_INCREMENT));
+		}
+
+		Random get(uint64_t index) const
+		{
+			Random random;
+			seed(random, index);
+
+			return random;
+		}
+	};
+
+	namespace detail {
+
+		inline Random*& boundRandom()
+		{
+			thread_local Random* bound = nullptr;
+			return bound;
+		}
+
+		inline Random& threadRandom()
+		{
+			thread_local Random random((uint64_t(std::random_device()()) << 32) ^ std::random_device()());
+			return random;
+		}
+
+	}
+
+	/**
+	 *	@brief	Random number generator of current thread
+	 *
+	 *	@details Returns stream bound with RandomBinding, or thread's own stream
+	 *			 (seeded from std::random_device) when nothing is bound. Genetic
+	 *			 operators should draw all random numbers from this generator
+	 *
+	 *	@note	getRandom().setSeed() on a thread without binding works like srand()
+	 */
+	inline Random& getRandom()
+	{
+		Random* bound = detail::boundRandom();
+		return bound != nullptr ? *bound : detail::threadRandom();
+	}
+
+	/**
+	 *	@brief	Binds a generator to current thread for lifetime of the object
+	 *
+	 *	@details While binding exists getRandom() called on this thread returns
+	 *			 given generator. Bindings can be nested, previous one is restored
+	 *			 on destruction
+	 */
+	class RandomBinding
+	{
+	private:
+		Random* previous_;
+
+	public:
+		explicit RandomBinding(Random& random) : previous_(detail::boundRandom())
+		{
+			detail::boundRandom() = &random;
+		}
+
+		~RandomBinding()
+		{
+			detail::boundRandom() = previous_;
+		}
+
+		RandomBinding(const RandomBinding&) = delete;
+		RandomBinding& operator=(const RandomBinding&) = delete;
+	};
+
+}
+
+#endif // !__RANDOM__
@@ -14,6 +14,8 @@
 
 #include <vector>
 
+#include "random.hpp"
+
 namespace ga {
 
 	/**
@@ -26,6 +28,7 @@ namespace ga {
 	 *	@tparam	SpecimenType Type of a member of population
 	 *
 	 *	@note	select(const Population& population, size_type mating_pool_size) must be overriden
+	 *	@note	Random numbers should be drawn from getRandom()
 	 *
 	 *	@see	Specimen
 	 */
@@ -37,6 +40,9 @@ namespace ga {
 
 		using Member = SpecimenType;
 		using Population = std::vector<SpecimenType>;
+		using Indices = std::vector<size_type>;
+
+		virtual ~Selection() = default;
 
 		/**
 		 *	@brief	A strategy for picking individuals for mating pool
@@ -55,6 +61,121 @@ namespace ga {
 		virtual Population select(const Population& population, size_type mating_pool_size) = 0;
 	};
 
+	/**
+	 *	@brief	Base class for selections picking parents by their position in population
+	 *
+	 *	@details Instead of building new population, selection fills a vector of
+	 *			 indices of chosen parents. This way environment copies every parent
+	 *			 only once - directly into mating pool - and strategies that need
+	 *			 to order population sort indices instead of Specimens
+	 *
+	 *	@tparam	SpecimenType Type of a member of population
+	 *
+	 *	@note	selectIndices(const Population& population, size_type mating_pool_size, Indices& indices)
+	 *			must be overriden
+	 */
+	template <typename SpecimenType>
+	class IndexSelection : public Selection<SpecimenType>
+	{
+	public:
+		using size_type = typename Selection<SpecimenType>::size_type;
+		using Population = typename Selection<SpecimenType>::Population;
+		using Indices = typename Selection<SpecimenType>::Indices;
+
+		/**
+		 *	@brief	A strategy for picking indices of individuals for mating pool
+		 *
+		 *	@param	population		 Evaluated population from previous generation
+		 *	@param	mating_pool_size Number of indices to pick
+		 *	@param	indices			 Output vector, it is cleared and filled with mating_pool_size
+		 *			indices, passing the same vector every generation reuses its storage
+		 *
+		 *	@note	This function has to be overriden
+		 */
+		virtual void selectIndices(const Population& population, size_type mating_pool_size, Indices& indices) = 0;
+
+		/**
+		 *	@brief	Picks indices of individuals having fitness column of population
+		 *
+		 *	@details Environment keeps fitness of population in a contiguous array and
+		 *			 passes it here. By default column is ignored and selectIndices()
+		 *			 is called
+		 *
+		 *	@param	fitness	Array of fitness, fitness[i] is fitness of population[i]
+		 */
+		virtual void selectByFitness(const Population& population, const double* /*fitness*/, size_type mating_pool_size, Indices& indices)
+		{
+			selectIndices(population, mating_pool_size, indices);
+		}
+
+		/**
+		 *	@brief	Builds mating pool by copying individuals picked by selectIndices()
+		 */
+		Population select(const Population& population, size_type mating_pool_size) override
+		{
+			Indices indices;
+			selectIndices(population, mating_pool_size, indices);
+
+			Population mating_pool;
+			mating_pool.reserve(indices.size());
+
+			for (auto index : indices)
+				mating_pool.emplace_back(population[index]);
+
+			return mating_pool;
+		}
+	};
+
+	/**
+	 *	@brief	Base class for selections depending only on fitness of individuals
+	 *
+	 *	@details Strategy scans flat array of fitness instead of Specimens. Environment
+	 *			 provides its fitness column, when population is passed directly fitness
+	 *			 is gathered into internal buffer first
+	 *
+	 *	@tparam	SpecimenType Type of a member of population
+	 *
+	 *	@note	selectFromFitness(const double* fitness, size_type size, size_type mating_pool_size, Indices& indices)
+	 *			must be overriden
+	 */
+	template <typename SpecimenType>
+	class FitnessSelection : public IndexSelection<SpecimenType>
+	{
+	public:
+		using size_type = typename IndexSelection<SpecimenType>::size_type;
+		using Population = typename IndexSelection<SpecimenType>::Population;
+		using Indices = typename IndexSelection<SpecimenType>::Indices;
+
+		/**
+		 *	@brief	A strategy for picking indices of individuals with given fitness
+		 *
+		 *	@param	fitness			 Array of fitness of individuals
+		 *	@param	size			 Number of individuals
+		 *	@param	mating_pool_size Number of indices to pick
+		 *	@param	indices			 Output vector, it is cleared and filled with mating_pool_size indices
+		 *
+		 *	@note	This function has to be overriden
+		 */
+		virtual void selectFromFitness(const double* fitness, size_type size, size_type mating_pool_size, Indices& indices) = 0;
+
+		void selectIndices(const Population& population, size_type mating_pool_size, Indices& indices) override
+		{
+			gathered_.resize(population.size());
+			for (size_type i = 0; i < population.size(); ++i)
+				gathered_[i] = population[i].getFitness();
+
+			selectFromFitness(gathered_.data(), gathered_.size(), mating_pool_size, indices);
+		}
+
+		void selectByFitness(const Population& population, const double* fitness, size_type mating_pool_size, Indices& indices) override
+		{
+			selectFromFitness(fitness, population.size(), mating_pool_size, indices);
+		}
+
+	private:
+		std::vector<double> gathered_;
+	};
+
 }
 
 #endif // !__SELECTION__
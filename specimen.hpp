@@ -14,8 +14,14 @@
 #ifndef __SPECIMEN__
 #define __SPECIMEN__
 
+#include <array>
 #include <vector>
+#include <tuple>
+#include <utility>
 #include <iostream>
+#include <type_traits>
+
+#include "change_set.hpp"
 
 namespace ga {
 
@@ -27,28 +33,101 @@ namespace ga {
 	 *
 	 *	@tparam GeneType		Used to build DNA of Specimen
 	 *	@tparam ChromosomeType	Used to evaluate Specimen trough fitness function
+	 *	@tparam GenotypeType	Container of Genes, std::vector<GeneType> by default,
+	 *							use BitGenotype for packed boolean genes
+	 *	@tparam FenotypeType	Container of Chromosomes, std::vector<ChromosomeType> by default
+	 *	@tparam IdentityFenotype When true Genotype is its own Fenotype, getFenotypeView()
+	 *							returns dna_ and Specimen doesn't store decoded Fenotype
+	 *
+	 *	@see	FixedSpecimen
 	 */
-	template <typename GeneType, typename ChromosomeType>
+	template <typename GeneType, typename ChromosomeType,
+			  typename GenotypeType = std::vector<GeneType>, typename FenotypeType = std::vector<ChromosomeType>, bool IdentityFenotype = false>
 	class Specimen
 	{
 	public:
 		using Gene = GeneType;
 		using Chromosome = ChromosomeType;
-		using Genotype = std::vector<Gene>;
-		using Fenotype = std::vector<Chromosome>;
+		using Genotype = GenotypeType;
+		using Fenotype = FenotypeType;
+
+		static_assert(!IdentityFenotype || std::is_same<Genotype, Fenotype>::value, "Identity Fenotype has to be of Genotype type");
 
 	private:
 		double fitness_;
 
+		//	Lazily decoded Fenotype, valid until Genotype is accessed for modification
+		mutable std::conditional_t<IdentityFenotype, std::tuple<>, Fenotype>	fenotype_cache_;
+		mutable bool															fenotype_valid_ = false;
+
+		//	Genotype was modified since last evaluation
+		bool modified_ = true;
+
+		//	Genes modified since last evaluation, used by DeltaFitness
+		ChangeSet<Gene> changes_;
+
 	protected:
 		Genotype dna_;
 
+	private:
+		const Fenotype& fenotypeView(std::false_type) const
+		{
+			if (!fenotype_valid_)
+			{
+				decodeFenotype(fenotype_cache_);
+				fenotype_valid_ = true;
+			}
+
+			return fenotype_cache_;
+		}
+
+		const Fenotype& fenotypeView(std::true_type) const { return dna_; }
+
+	protected:
+
+		/**
+		 *	@brief	Decodes Genotype into given Fenotype
+		 *
+		 *	@details By default assigns result of getFenotype(). Override it to decode
+		 *			 in place, so that storage of cached Fenotype is reused
+		 */
+		virtual void decodeFenotype(Fenotype& fenotype) const
+		{
+			fenotype = getFenotype();
+		}
+
+		/**
+		 *	@brief	Marks cached Fenotype as outdated
+		 *
+		 *	@note	Has to be called by derived classes modifying dna_ directly after
+		 *			Fenotype could have been accessed
+		 */
+		void invalidateFenotype() { fenotype_valid_ = false; }
+
 	public:
 		Specimen() : fitness_(0.0) { }
-		explicit Specimen(const Genotype& genotype) : dna_(genotype), fitness_(0.0) {}
-		explicit Specimen(Genotype&& genotype) : dna_(genotype), fitness_(0.0) {}
+		explicit Specimen(const Genotype& genotype) : fitness_(0.0), dna_(genotype) {}
+		explicit Specimen(Genotype&& genotype) : fitness_(0.0), dna_(std::move(genotype)) {}
 		virtual ~Specimen() = default;
 
+		//	Cached Fenotype is not copied - copies are usually modified right away,
+		//	copy assignment keeps storage of cache for reuse. Virtual destructor
+		//	suppresses implicit move operations, so they are defaulted explicitly
+		Specimen(const Specimen& other) : fitness_(other.fitness_), modified_(other.modified_), changes_(other.changes_), dna_(other.dna_) { }
+		Specimen(Specimen&&) = default;
+		Specimen& operator=(Specimen&&) = default;
+
+		Specimen& operator=(const Specimen& other)
+		{
+			fitness_ = other.fitness_;
+			modified_ = other.modified_;
+			changes_ = other.changes_;
+			dna_ = other.dna_;
+			fenotype_valid_ = false;
+
+			return *this;
+		}
+
 		/**
 		 *	@brief Conversion of Genotype into Fenotype
 		 *	
@@ -57,17 +136,285 @@ namespace ga {
 		 */
 		virtual Fenotype getFenotype() const = 0;
 
+		/**
+		 *	@brief	Fenotype decoded once and cached until Genotype changes
+		 *
+		 *	@details Use it instead of getFenotype() in fitness functions and finish
+		 *			 conditions, repeated calls don't decode and don't allocate
+		 *
+		 *	@note	Cache is filled on first call, so concurrent first calls on the same
+		 *			Specimen are not thread safe
+		 *
+		 *	@see	IdentitySpecimen
+		 */
+		virtual const Fenotype& getFenotypeView() const
+		{
+			return fenotypeView(std::integral_constant<bool, IdentityFenotype>());
+		}
+
 		virtual void print() const
 		{
 			std::cout << fitness_ << '\n';
 		}
 
-		virtual Genotype& getGenotype() { return dna_; }
+		/**
+		 *	@brief	Access to Genotype for modification, invalidates cached Fenotype
+		 *
+		 *	@details Whole Genotype is treated as modified, so next evaluation
+		 *			 can't be incremental
+		 */
+		virtual Genotype& getGenotype()
+		{
+			changes_.markAll();
+			markModified();
+
+			return dna_;
+		}
+
+		const Genotype& getGenotype() const { return dna_; }
+
+		/**
+		 *	@brief	Access to Genotype for modification recorded in getChanges()
+		 *
+		 *	@details Genotype isn't marked as modified, so that Specimens left unchanged
+		 *			 by operators keep their Fenotype and fitness
+		 *
+		 *	@note	Every modification has to be recorded in change set before it is made
+		 *			and markModified() has to be called after it
+		 */
+		Genotype& getTrackedGenotype() { return dna_; }
+
+		/**
+		 *	@brief	Marks Genotype as modified since last evaluation, invalidates cached Fenotype
+		 */
+		void markModified()
+		{
+			invalidateFenotype();
+			modified_ = true;
+		}
+
+		/**
+		 *	@brief	Called by environment after Specimen is evaluated
+		 */
+		void markEvaluated() { modified_ = false; }
+
+		/**
+		 *	@brief	False if Genotype hasn't been modified since last evaluation, so its fitness is up to date
+		 */
+		bool isModified() const { return modified_; }
+
+		/**
+		 *	@brief	Genes modified since last evaluation
+		 */
+		ChangeSet<Gene>&		getChanges()	   { return changes_; }
+		const ChangeSet<Gene>&	getChanges() const { return changes_; }
 
 		inline double	getFitness() const { return fitness_; }
 		inline void		setFitness(double fitness) { fitness_ = fitness; }
 	};
 
+	/**
+	 *	@brief	Specimen whose Fenotype is equal to its Genotype
+	 *
+	 *	@details getFenotypeView() returns reference to dna_, so accessing Fenotype
+	 *			 never copies nor allocates and no decoded Fenotype is stored
+	 *
+	 *	@tparam	GeneType Used both as Gene and Chromosome
+	 */
+	template <typename GeneType>
+	class IdentitySpecimen : public Specimen<GeneType, GeneType, std::vector<GeneType>, std::vector<GeneType>, true>
+	{
+	public:
+		using Base = Specimen<GeneType, GeneType, std::vector<GeneType>, std::vector<GeneType>, true>;
+		using Genotype = typename Base::Genotype;
+		using Fenotype = typename Base::Fenotype;
+
+		IdentitySpecimen() = default;
+		explicit IdentitySpecimen(const Genotype& genotype) : Base(genotype) { }
+		explicit IdentitySpecimen(Genotype&& genotype) : Base(std::move(genotype)) { }
+
+		Fenotype getFenotype() const override
+		{
+			return this->dna_;
+		}
+	};
+
+	namespace detail {
+
+		/**
+		 *	@brief	Bookkeeping of Specimens with N Genes stored inline
+		 *
+		 *	@details Has no virtual functions and no user provided copy operations,
+		 *			 so that derived Specimens are trivially copyable when Genes are
+		 *			 and population of them is copied as a block of memory. Changes
+		 *			 are recorded in FixedChangeSet stored inline as well
+		 *
+		 *	@see	FixedSpecimen
+		 *	@see	FixedIdentitySpecimen
+		 */
+		template <typename GeneType, typename ChromosomeType, size_t N>
+		class FixedSpecimenBase
+		{
+		public:
+			using Gene = GeneType;
+			using Chromosome = ChromosomeType;
+			using Genotype = std::array<GeneType, N>;
+			using Fenotype = std::array<ChromosomeType, N>;
+			using Changes = FixedChangeSet<GeneType, N>;
+
+			static constexpr size_t LENGTH = N;
+
+		private:
+			double fitness_;
+
+			//	Genotype was modified since last evaluation
+			bool modified_;
+
+		protected:
+			//	Fenotype cached by derived class is up to date
+			mutable bool fenotype_valid_;
+
+		private:
+			//	Genes modified since last evaluation, used by DeltaFitness
+			Changes changes_;
+
+		protected:
+			Genotype dna_;
+
+		public:
+			//	Genes are value initialized, std::array of scalars would be left indeterminate
+			FixedSpecimenBase() : fitness_(0.0), modified_(true), fenotype_valid_(false), dna_() { }
+			explicit FixedSpecimenBase(const Genotype& genotype) : fitness_(0.0), modified_(true), fenotype_valid_(false), dna_(genotype) { }
+
+			void print() const
+			{
+				std::cout << fitness_ << '\n';
+			}
+
+			/**
+			 *	@brief	Access to Genotype for modification, invalidates cached Fenotype
+			 *
+			 *	@see	Specimen::getGenotype
+			 */
+			Genotype& getGenotype()
+			{
+				changes_.markAll();
+				markModified();
+
+				return dna_;
+			}
+
+			const Genotype& getGenotype() const { return dna_; }
+
+			/**
+			 *	@brief	Access to Genotype for modification recorded in getChanges()
+			 *
+			 *	@see	Specimen::getTrackedGenotype
+			 */
+			Genotype& getTrackedGenotype() { return dna_; }
+
+			void markModified()
+			{
+				fenotype_valid_ = false;
+				modified_ = true;
+			}
+
+			void markEvaluated() { modified_ = false; }
+			bool isModified() const { return modified_; }
+
+			Changes&		getChanges()	   { return changes_; }
+			const Changes&	getChanges() const { return changes_; }
+
+			inline double	getFitness() const { return fitness_; }
+			inline void		setFitness(double fitness) { fitness_ = fitness; }
+		};
+
+		template <typename GeneType, typename ChromosomeType, size_t N>
+		constexpr size_t FixedSpecimenBase<GeneType, ChromosomeType, N>::LENGTH;
+
+	}
+
+	/**
+	 *	@brief	Specimen with Genotype of length known at compile time
+	 *
+	 *	@details Genes and Chromosomes are stored inline in std::array, so creating
+	 *			 and copying Specimens doesn't allocate and Specimen of trivially
+	 *			 copyable Genes and Chromosomes is trivially copyable. Genetic operators
+	 *			 are instantiated with std::array<GeneType, N> as GenotypeType (see
+	 *			 BindOperator), so their loops over genes.size() have constant bounds.
+	 *			 Nothing is virtual - derived class defines getFenotype() hiding the
+	 *			 one of FixedSpecimen and passes itself as DerivedType, so that
+	 *			 getFenotypeView() decodes Fenotype with it
+	 *
+	 *	@tparam DerivedType		Class deriving from FixedSpecimen
+	 *	@tparam GeneType		Used to build DNA of Specimen
+	 *	@tparam ChromosomeType	Used to evaluate Specimen trough fitness function
+	 *	@tparam N				Number of Genes
+	 *
+	 *	@see	FixedIdentitySpecimen
+	 */
+	template <typename DerivedType, typename GeneType, typename ChromosomeType, size_t N>
+	class FixedSpecimen : public detail::FixedSpecimenBase<GeneType, ChromosomeType, N>
+	{
+	public:
+		using Genotype = typename detail::FixedSpecimenBase<GeneType, ChromosomeType, N>::Genotype;
+		using Fenotype = typename detail::FixedSpecimenBase<GeneType, ChromosomeType, N>::Fenotype;
+
+	private:
+		//	Lazily decoded Fenotype, valid until Genotype is accessed for modification
+		mutable Fenotype fenotype_cache_;
+
+	public:
+		FixedSpecimen() = default;
+		explicit FixedSpecimen(const Genotype& genotype) : detail::FixedSpecimenBase<GeneType, ChromosomeType, N>(genotype) { }
+
+		/**
+		 *	@brief	Fenotype decoded with DerivedType::getFenotype() once and cached
+		 *			until Genotype changes
+		 *
+		 *	@see	Specimen::getFenotypeView
+		 */
+		const Fenotype& getFenotypeView() const
+		{
+			if (!this->fenotype_valid_)
+			{
+				fenotype_cache_ = static_cast<const DerivedType&>(*this).getFenotype();
+				this->fenotype_valid_ = true;
+			}
+
+			return fenotype_cache_;
+		}
+	};
+
+	/**
+	 *	@brief	Specimen with N Genes stored inline, Fenotype is equal to Genotype
+	 *
+	 *	@details Decoded Fenotype isn't stored, so Specimen takes just N Genes and
+	 *			 bookkeeping of Specimen. It is trivially copyable when Gene is
+	 *
+	 *	@see	FixedSpecimen
+	 *	@see	IdentitySpecimen
+	 */
+	template <typename GeneType, size_t N>
+	class FixedIdentitySpecimen : public detail::FixedSpecimenBase<GeneType, GeneType, N>
+	{
+	public:
+		using Genotype = typename detail::FixedSpecimenBase<GeneType, GeneType, N>::Genotype;
+		using Fenotype = typename detail::FixedSpecimenBase<GeneType, GeneType, N>::Fenotype;
+
+		FixedIdentitySpecimen() = default;
+		explicit FixedIdentitySpecimen(const Genotype& genotype) : detail::FixedSpecimenBase<GeneType, GeneType, N>(genotype) { }
+
+		Fenotype getFenotype() const
+		{
+			return this->dna_;
+		}
+
+		const Fenotype& getFenotypeView() const { return this->dna_; }
+	};
+
+	static_assert(std::is_trivially_copyable<FixedIdentitySpecimen<int, 16> >::value, "FixedIdentitySpecimen of trivially copyable Genes has to be trivially copyable");
+
 }
 
 #endif // __SPECIMEN__
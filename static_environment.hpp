@@ -0,0 +1,140 @@
+/**
+ *	Class defining environment with genetic operators chosen at compile
+ *	time. Operators are held by value and called without virtual dispatch,
+ *	so they can be inlined into loops over population
+ *
+ *	Authors: Michal Swiatek, Michal Sulek
+ *	Update:	 17.10.2026
+ *
+ *	Github repository: https://github.com/MichalKonradSulek/ZPR
+ */
+
+#ifndef __STATIC_ENVIRONMENT__
+#define __STATIC_ENVIRONMENT__
+
+#include <utility>
+#include <type_traits>
+
+#include "environment.hpp"
+
+namespace ga {
+
+	namespace detail {
+
+		/**
+		 *	@brief	Policy type that can't be derived from
+		 *
+		 *	@details Virtual functions called on object of final type are resolved at
+		 *			 compile time, so predefined (polymorphic) operators used as policies
+		 *			 are called directly
+		 */
+		template <typename Policy>
+		class FinalPolicy final : public Policy
+		{
+		public:
+			using Policy::Policy;
+
+			FinalPolicy() = default;
+			FinalPolicy(const Policy& policy) : Policy(policy) { }
+			FinalPolicy(Policy&& policy) : Policy(std::move(policy)) { }
+		};
+
+		template <typename Policy>
+		using StaticPolicy = std::conditional_t<std::is_polymorphic<Policy>::value && !std::is_final<Policy>::value,
+												FinalPolicy<Policy>, Policy>;
+
+	}
+
+	/**
+	 *	@brief	Environment with genetic operators composed at compile time
+	 *
+	 *	@details Selection, crossover and mutation stages call policies held by
+	 *			 value instead of strategies behind pointers. Policies don't have
+	 *			 to derive from Mutation, Crossover or Selection, predefined
+	 *			 strategies can be used directly, e.g.
+	 *			 StaticEnvironment<S, SwapGeneMutation<int>, SinglePointCrossover<int>, TournamentSelection<S>>.
+	 *			 Remaining features (evaluation, succession, local search,
+	 *			 instrumentation) are shared with Environment
+	 *
+	 *	@tparam	SpecimenType	Type of a member of population
+	 *	@tparam	MutationPolicy	Type providing bool mutateTracked(Genotype&, Changes&)
+	 *	@tparam	CrossoverPolicy	Type providing bool crossTracked(Genotype&, Genotype&, Changes&, Changes&)
+	 *	@tparam	SelectionPolicy	Type providing selectIndices(const Population&, size_type, Indices&)
+	 *
+	 *	@note	setMutationType(), setCrossoverType() and setSelectionType() of Environment
+	 *			have no effect, operators are accessed with getMutation(), getCrossover()
+	 *			and getSelection()
+	 *
+	 *	@see	Environment
+	 */
+	template <typename SpecimenType, typename MutationPolicy, typename CrossoverPolicy, typename SelectionPolicy>
+	class StaticEnvironment : public Environment<SpecimenType>
+	{
+	public:
+		using size_type		= typename Environment<SpecimenType>::size_type;
+		using Gene			= typename Environment<SpecimenType>::Gene;
+		using Genotype		= typename Environment<SpecimenType>::Genotype;
+		using Changes		= typename Environment<SpecimenType>::Changes;
+		using Population	= typename Environment<SpecimenType>::Population;
+
+		using Mutation		= detail::StaticPolicy<MutationPolicy>;
+		using Crossover		= detail::StaticPolicy<CrossoverPolicy>;
+		using Selection		= detail::StaticPolicy<SelectionPolicy>;
+
+	protected:
+		Mutation	mutation_;
+		Crossover	crossover_;
+		Selection	selection_;
+
+		void selection() override
+		{
+			selectIndices(std::is_base_of<IndexSelection<SpecimenType>, SelectionPolicy>());
+			this->copyParents();
+		}
+
+		//	IndexSelection scans fitness column instead of population
+		void selectIndices(std::true_type)
+		{
+			if (!this->stats_valid_)
+				this->updateStatistics();
+
+			selection_.selectByFitness(this->population_, this->fitness_column_.data(), this->getOffspringSize(), this->parent_indices_);
+		}
+
+		void selectIndices(std::false_type)
+		{
+			selection_.selectIndices(this->population_, this->getOffspringSize(), this->parent_indices_);
+		}
+
+		void crossover(Executor& executor) override
+		{
+			this->crossMatingPool(executor, [this](Genotype& parentA, Genotype& parentB, Changes& changesA, Changes& changesB)
+			{
+				return crossover_.crossTracked(parentA, parentB, changesA, changesB);
+			});
+		}
+
+		void mutation(Executor& executor) override
+		{
+			this->mutateOffspring(executor, [this](Genotype& genes, Changes& changes)
+			{
+				return mutation_.mutateTracked(genes, changes);
+			});
+		}
+
+	public:
+		explicit StaticEnvironment(size_type population_size,
+								   MutationPolicy mutation = MutationPolicy(),
+								   CrossoverPolicy crossover = CrossoverPolicy(),
+								   SelectionPolicy selection = SelectionPolicy())
+			: Environment<SpecimenType>(population_size),
+			  mutation_(std::move(mutation)), crossover_(std::move(crossover)), selection_(std::move(selection)) { }
+
+		MutationPolicy& getMutation() { return mutation_; }
+		CrossoverPolicy& getCrossover() { return crossover_; }
+		SelectionPolicy& getSelection() { return selection_; }
+	};
+
+}
+
+#endif // !__STATIC_ENVIRONMENT__
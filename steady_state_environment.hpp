@@ -0,0 +1,394 @@
+/**
+ *	Class defining steady-state (asynchronous) genetic algorithm. There
+ *	are no generations - worker threads continuously select parents,
+ *	create offspring, evaluate it and insert it into population, so one
+ *	slow evaluation doesn't stall other threads
+ *
+ *	Authors: Michal Swiatek, Michal Sulek
+ *	Update:	 17.10.2026
+ *
+ *	Github repository: https://github.com/MichalKonradSulek/ZPR
+ */
+
+#ifndef __STEADY_STATE_ENVIRONMENT__
+#define __STEADY_STATE_ENVIRONMENT__
+
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <exception>
+#include <type_traits>
+
+#include "environment.hpp"
+#include "random.hpp"
+#include "exception.hpp"
+
+namespace ga {
+
+	/**
+	 *	@brief	Member of population replaced by new offspring
+	 *
+	 *	@details Worst			 - offspring replaces worst member if it is better
+	 *			 TournamentLoser - worst of randomly picked members is always replaced
+	 */
+	enum class ReplacementPolicy
+	{
+		Worst,
+		TournamentLoser
+	};
+
+	/**
+	 *	@brief	An environment performing steady-state evolution on worker threads
+	 *
+	 *	@details Every worker repeatedly: takes a batch of parents (under lock),
+	 *			 crosses, mutates and locally improves their copies, evaluates them (without lock)
+	 *			 and inserts them into population according to ReplacementPolicy
+	 *			 (under lock). Genetic operators, selection strategy, executor used
+	 *			 for initial evaluation and DeltaFitness support are shared with
+	 *			 Environment. Every worker draws random numbers from its own stream
+	 *			 split from environment's generator. Amortized work under lock per
+	 *			 offspring doesn't grow with population: parents picked by IndexSelection
+	 *			 come from a pool refilled after a fixed fraction of population is
+	 *			 created, worst member is kept on top of a heap
+	 *
+	 *	@tparam	SpecimenType Type of a member of population
+	 *
+	 *	@note	Mutation, Crossover and LocalSearch are called concurrently by workers, so they have
+	 *			to be thread safe (all predefined ones are). Selection is called only
+	 *			under lock
+	 *	@note	Order of insertions depends on thread scheduling, so runs with more than
+	 *			one worker are not reproducible even with seeded environment
+	 *
+	 *	@see	Environment
+	 */
+	template <typename SpecimenType>
+	class SteadyStateEnvironment : public Environment<SpecimenType>
+	{
+	public:
+		using size_type		= typename Environment<SpecimenType>::size_type;
+		using Population	= typename Environment<SpecimenType>::Population;
+		using Indices		= typename Environment<SpecimenType>::Indices;
+
+	protected:
+		size_type			number_of_workers_;
+		size_type			batch_size_;
+
+		ReplacementPolicy	replacement_policy_;
+		size_type			tournament_size_;
+
+		std::mutex			population_mutex_;
+
+		//	Parents picked by one call of selection strategy, consumed by workers in batches.
+		//	Larger pools make selection cheaper but parents are picked from older population
+		static const size_type POOLS_PER_POPULATION = 16;
+
+		Indices				parent_pool_;
+		size_type			pool_position_ = 0;
+
+		//	Binary min-heap of indices of population ordered by fitness, kept by Worst
+		//	policy, heap_slots_[i] is position of member i in worst_heap_
+		Indices				worst_heap_;
+		Indices				heap_slots_;
+
+		bool heapLess(size_type a, size_type b) const
+		{
+			return this->fitness_column_[worst_heap_[a]] < this->fitness_column_[worst_heap_[b]];
+		}
+
+		void heapSwap(size_type a, size_type b)
+		{
+			std::swap(worst_heap_[a], worst_heap_[b]);
+			heap_slots_[worst_heap_[a]] = a;
+			heap_slots_[worst_heap_[b]] = b;
+		}
+
+		void siftDown(size_type slot)
+		{
+			for (size_type child; (child = 2 * slot + 1) < worst_heap_.size(); slot = child)
+			{
+				if (child + 1 < worst_heap_.size() && heapLess(child + 1, child))
+					++child;
+
+				if (!heapLess(child, slot))
+					break;
+
+				heapSwap(slot, child);
+			}
+		}
+
+		/**
+		 *	@brief	Prepares fitness column, parent pool and heap of worst members
+		 *			of evaluated population, called before workers start
+		 */
+		void prepareInsertions()
+		{
+			this->updateStatistics();
+
+			parent_pool_.clear();
+			pool_position_ = 0;
+
+			worst_heap_.clear();
+			heap_slots_.clear();
+
+			if (replacement_policy_ != ReplacementPolicy::Worst)
+				return;
+
+			size_type size = this->population_.size();
+
+			worst_heap_.resize(size);
+			heap_slots_.resize(size);
+			for (size_type i = 0; i < size; ++i)
+				worst_heap_[i] = heap_slots_[i] = i;
+
+			for (size_type slot = size / 2; slot-- > 0; )
+				siftDown(slot);
+		}
+
+		/**
+		 *	@brief	Selects parents and copies them into offspring, called under lock
+		 *
+		 *	@details IndexSelection picks parents for 1 / POOLS_PER_POPULATION of
+		 *			 population at once from fitness column. Workers take consecutive
+		 *			 batches of this pool, so cost of selection under lock per batch
+		 *			 doesn't grow with size of population
+		 */
+		void selectParents(Population& offspring, Indices& indices)
+		{
+			auto index_selection = dynamic_cast<IndexSelection<SpecimenType>*>(this->selection_type_.get());
+
+			if (index_selection == nullptr)
+			{
+				offspring = this->selection_type_->select(this->population_, batch_size_);
+				return;
+			}
+
+			if (pool_position_ + batch_size_ > parent_pool_.size())
+			{
+				size_type pool_size = std::max(batch_size_, this->population_.size() / POOLS_PER_POPULATION / batch_size_ * batch_size_);
+
+				index_selection->selectByFitness(this->population_, this->fitness_column_.data(), pool_size, parent_pool_);
+				pool_position_ = 0;
+			}
+
+			indices.assign(parent_pool_.begin() + pool_position_, parent_pool_.begin() + pool_position_ + batch_size_);
+			pool_position_ += batch_size_;
+
+			offspring.resize(indices.size());
+			for (size_type i = 0; i < indices.size(); ++i)
+				offspring[i] = this->population_[indices[i]];
+		}
+
+		/**
+		 *	@brief	Index of member to be replaced, called under lock
+		 */
+		size_type pickReplaced(Random& random) const
+		{
+			if (replacement_policy_ == ReplacementPolicy::Worst)
+				return worst_heap_.front();
+
+			const std::vector<double>& fitness = this->fitness_column_;
+
+			size_type replaced = random.uniform(fitness.size());
+			for (size_type i = 1; i < tournament_size_; ++i)
+			{
+				size_type candidate = random.uniform(fitness.size());
+				if (fitness[candidate] < fitness[replaced])
+					replaced = candidate;
+			}
+
+			return replaced;
+		}
+
+		/**
+		 *	@brief	Inserts evaluated offspring into population, called under lock
+		 */
+		void insertOffspring(Population& offspring, Random& random)
+		{
+			for (auto& child : offspring)
+			{
+				size_type replaced = pickReplaced(random);
+
+				if (replacement_policy_ == ReplacementPolicy::Worst && !(child.getFitness() > this->fitness_column_[replaced]))
+					continue;
+
+				//	Copy assignment reuses Genotype storage of replaced member
+				this->population_[replaced] = child;
+				this->fitness_column_[replaced] = child.getFitness();
+
+				if (!worst_heap_.empty())
+				{
+					//	Only worst member is replaced, its fitness can only grow
+					siftDown(heap_slots_[replaced]);
+				}
+			}
+		}
+
+		template <typename FitnessFunction, typename FinishCondition>
+		void work(FitnessFunction& fitness, FinishCondition& finishCondition, long long number_of_evaluations,
+				  std::atomic<long long>& evaluations, std::atomic<bool>& stop, Random random)
+		{
+			using IsDelta = std::is_base_of<DeltaFitness<SpecimenType>, FitnessFunction>;
+
+			RandomBinding binding(random);
+
+			Population offspring;
+			Indices indices;
+
+			long long check_interval = std::max<long long>(1, this->population_.size());
+
+			while (!stop.load(std::memory_order_relaxed))
+			{
+				{
+					std::lock_guard<std::mutex> lock(population_mutex_);
+					selectParents(offspring, indices);
+				}
+
+				for (size_type i = 0; i + 1 < offspring.size(); i += 2)
+				{
+					SpecimenType& parentA = offspring[i];
+					SpecimenType& parentB = offspring[i + 1];
+
+					if (this->crossover_type_->crossTracked(parentA.getTrackedGenotype(), parentB.getTrackedGenotype(), parentA.getChanges(), parentB.getChanges()))
+					{
+						parentA.markModified();
+						parentB.markModified();
+					}
+				}
+
+				for (auto& child : offspring)
+				{
+					if (this->mutation_type_->mutateTracked(child.getTrackedGenotype(), child.getChanges()))
+						child.markModified();
+
+					if (this->local_search_type_ && random.chance(this->local_search_rate_) &&
+						this->local_search_type_->improveTracked(child.getTrackedGenotype(), child.getChanges()))
+						child.markModified();
+
+					//	Unmodified copies of parents already have their fitness
+					if (child.isModified())
+						this->finishEvaluation(child, this->evaluateMember(fitness, child, IsDelta()), IsDelta());
+				}
+
+				long long previous = evaluations.fetch_add(offspring.size());
+				long long current = previous + offspring.size();
+
+				std::lock_guard<std::mutex> lock(population_mutex_);
+				insertOffspring(offspring, random);
+
+				if (number_of_evaluations != -1 && current >= number_of_evaluations)
+					stop = true;
+
+				//	Finish condition and statistics are checked once per population size evaluations
+				if (previous / check_interval != current / check_interval)
+				{
+					++this->stats_.generation;
+					this->updateStatistics();
+
+					if (checkFinish(finishCondition, this->population_, this->stats_))
+						stop = true;
+				}
+			}
+		}
+
+	public:
+		/**
+		 *	@param	population_size		Size of population
+		 *	@param	number_of_workers	Number of worker threads
+		 *	@param	batch_size			Number of parents selected by worker at once, it is
+		 *								rounded up to even number
+		 */
+		explicit SteadyStateEnvironment(size_type population_size,
+										size_type number_of_workers = std::max(1u, std::thread::hardware_concurrency()),
+										size_type batch_size = 8)
+			: Environment<SpecimenType>(population_size),
+			  number_of_workers_(std::max<size_type>(1, number_of_workers)),
+			  batch_size_(std::max<size_type>(2, batch_size + batch_size % 2)),
+			  replacement_policy_(ReplacementPolicy::Worst),
+			  tournament_size_(2) { }
+
+		/**
+		 *	@brief	Perform steady-state evolution
+		 *
+		 *	@details Initial population is evaluated with executor of environment, then
+		 *			 workers run until FinishCondition is met or given number of offspring
+		 *			 is created
+		 *
+		 *	@tparam FitnessFunction	Functor object taking SpecimenType as an argument and returning
+		 *			it's fitness value converted to double, called concurrently by workers
+		 *	@tparam	FinishCondition	Functor object taking const Population& and optionally
+		 *			const GenerationStats& and returning a boolean indicator whether a finish
+		 *			condition is met, called under lock
+		 *
+		 *	@param	number_of_evaluations Maximum number of created offspring, set to -1 to
+		 *			perform evolution until FinishCondition is met
+		 */
+		template <typename FitnessFunction, typename FinishCondition>
+		void runSimulation(FitnessFunction fitness, FinishCondition finishCondition, long long number_of_evaluations = -1)
+		{
+			{
+				RandomBinding binding(this->random_);
+				this->evaluation(fitness, *this->executor_);
+			}
+
+			if (this->population_.empty() || checkFinish(finishCondition, this->population_, this->stats_))
+				return;
+
+			prepareInsertions();
+
+			std::atomic<long long> evaluations(0);
+			std::atomic<bool> stop(false);
+
+			std::vector<std::exception_ptr> errors(number_of_workers_);
+			std::vector<std::thread> workers;
+			workers.reserve(number_of_workers_);
+
+			for (size_type i = 0; i < number_of_workers_; ++i)
+			{
+				workers.emplace_back([this, i, &fitness, &finishCondition, number_of_evaluations, &evaluations, &stop, &errors, worker_random = this->random_.split()]()
+				{
+					try
+					{
+						work(fitness, finishCondition, number_of_evaluations, evaluations, stop, worker_random);
+					}
+					catch (...)
+					{
+						errors[i] = std::current_exception();
+						stop = true;
+					}
+				});
+			}
+
+			for (auto& worker : workers)
+				worker.join();
+
+			this->updateStatistics();
+
+			for (auto& error : errors)
+			{
+				if (error)
+					std::rethrow_exception(error);
+			}
+		}
+
+		/**
+		 *	@brief	Sets policy of inserting offspring into population
+		 *
+		 *	@param	tournament_size Number of members compared by TournamentLoser policy
+		 */
+		void setReplacementPolicy(ReplacementPolicy replacement_policy, size_type tournament_size = 2)
+		{
+			replacement_policy_ = replacement_policy;
+			tournament_size_ = std::max<size_type>(1, tournament_size);
+		}
+
+		void setNumberOfWorkers(size_type number_of_workers) { number_of_workers_ = std::max<size_type>(1, number_of_workers); }
+		size_type getNumberOfWorkers() const { return number_of_workers_; }
+
+		void setBatchSize(size_type batch_size) { batch_size_ = std::max<size_type>(2, batch_size + batch_size % 2); }
+		size_type getBatchSize() const { return batch_size_; }
+	};
+
+}
+
+#endif // !__STEADY_STATE_ENVIRONMENT__
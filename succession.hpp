@@ -0,0 +1,58 @@
+/*
+ *	Class representing succession - choice of members of next
+ *	generation from current population and its evaluated offspring.
+ *	This is an Interface for all succession strategies
+ *
+ *	Authors: Michal Swiatek, Michal Sulek
+ *	Update:	 17.10.2026
+ *
+ *	Github repository: https://github.com/MichalKonradSulek/ZPR
+ */
+
+#ifndef __SUCCESSION__
+#define __SUCCESSION__
+
+#include <vector>
+
+namespace ga {
+
+	/**
+	 *	@brief	Base class representing succession of generations
+	 *
+	 *	@details When succession is set, environment evaluates offspring before
+	 *			 succession, so both populations passed to succeed() have up to
+	 *			 date fitness. Strategies should move Specimens between populations
+	 *			 with swaps instead of copies
+	 *
+	 *	@tparam	SpecimenType Type of a member of population
+	 *
+	 *	@note	succeed(Population& population, Population& offspring) must be overriden
+	 *
+	 *	@see	Environment::setSuccessionType
+	 */
+	template <typename SpecimenType>
+	class Succession
+	{
+	public:
+		using size_type = size_t;
+
+		using Population = std::vector<SpecimenType>;
+		using Indices = std::vector<size_type>;
+
+		virtual ~Succession() = default;
+
+		/**
+		 *	@brief	Builds next generation
+		 *
+		 *	@param	population	Evaluated current generation, replaced with next generation
+		 *	@param	offspring	Evaluated offspring, afterwards holds leftovers that environment
+		 *						may reuse as storage for next offspring
+		 *
+		 *	@note	This function has to be overriden
+		 */
+		virtual void succeed(Population& population, Population& offspring) = 0;
+	};
+
+}
+
+#endif // !__SUCCESSION__